@@ -0,0 +1,190 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_backtest_utilities.hpp"// for validateBacktestParameters, FXBacktestOptions
+#include "fx_backtester.h"          // for FXBacktester, FXBarHistory, FXBacktestResult
+#include "fx_parameter_sweep.h"     // for FXParameterSweep, FXSweepSummary
+#include "fx_task_pool.h"           // for FXTaskPool
+
+#include <algorithm> // for replace, sort
+#include <chrono>    // for steady_clock, duration
+#include <cstddef>   // for size_t
+#include <expected>  // for expected
+#include <filesystem>// for path, directory_iterator, is_directory
+#include <iostream>  // for operator<<, basic_ostream, cout
+#include <print>     // for print
+#include <string>    // for string
+#include <vector>    // for vector
+
+namespace
+{
+
+// EUR_USD.csv -> EUR/USD
+std::string symbol_from_path(std::filesystem::path const& file)
+{
+    std::string symbol = file.stem().string();
+    std::replace(symbol.begin(), symbol.end(), '_', '/');
+    return symbol;
+}
+
+std::expected<fxordermgmt::FXBarHistory, fxordermgmt::FXException> load_bars(std::filesystem::path const& file, bool convert_to_binary)
+{
+    if (file.extension() == ".fxbars")
+    {
+        return fxordermgmt::FXBacktester::load_binary_bars(file.string());
+    }
+    auto history = fxordermgmt::FXBacktester::load_csv_bars(file.string());
+    if (history && convert_to_binary)
+    {
+        std::filesystem::path binary_file = file;
+        auto write_response = fxordermgmt::FXBacktester::write_binary_bars(binary_file.replace_extension(".fxbars").string(), history.value());
+        if (! write_response)
+        {
+            return std::expected<fxordermgmt::FXBarHistory, fxordermgmt::FXException> {std::unexpect, std::move(write_response.error())};
+        }
+    }
+    return history;
+}
+
+void print_error(fxordermgmt::FXException const& error)
+{
+    std::cout << "Error Location: " << error.where() << '\n';
+    std::cout << error.what() << '\n';
+}
+
+double win_percent(fxordermgmt::FXBacktestResult const& result) noexcept
+{
+    return (result.closed_trades) ? 100.0 * static_cast<double>(result.winning_trades) / static_cast<double>(result.closed_trades) : 0.0;
+}
+
+int run_sweep(fxordermgmt::FXBacktestOptions const& options, std::vector<std::string> const& symbols,
+    std::vector<fxordermgmt::FXBarHistory> const& bar_data, std::chrono::steady_clock::time_point start)
+{
+    auto grid = fxordermgmt::FXParameterSweep::parse_parameter_grid(options.sweep_grid);
+    auto spans = fxordermgmt::FXParameterSweep::parse_spans(options.sweep_spans);
+    if (! grid || ! spans)
+    {
+        print_error((! grid) ? grid.error() : spans.error());
+        return 1;
+    }
+    auto summary = fxordermgmt::FXParameterSweep::run(symbols, bar_data, spans.value(), grid.value(), options.config, options.max_threads);
+    if (! summary)
+    {
+        print_error(summary.error());
+        return 1;
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+    // ------------------
+    std::print(std::cout, "{:>5} {:<10} {:<10} {:<32} {:>14} {:>14} {:>8} {:>8}\n", "Rank", "Symbol", "Span", "Parameters", "Profit",
+        "Max Drawdown", "Orders", "Win %");
+    for (std::size_t x = 0; x < summary.value().results.size(); ++x)
+    {
+        auto const& row = summary.value().results[x];
+        std::print(std::cout, "{:>5} {:<10} {:<10} {:<32} {:>14.2f} {:>14.2f} {:>8} {:>8.2f}\n", x + 1, row.result.symbol,
+            row.span.update_interval + ':' + std::to_string(row.span.update_span), fxordermgmt::FXParameterSweep::format_parameters(row.parameters),
+            row.total_profit, row.result.max_drawdown, row.result.order_count, win_percent(row.result));
+    }
+    std::print(std::cout, "Ran {} Jobs in {:.2f} Seconds", summary.value().results.size(), elapsed.count());
+    if (summary.value().skipped_jobs)
+    {
+        std::print(std::cout, " | Skipped {} Jobs: {}", summary.value().skipped_jobs, summary.value().first_skip_reason);
+    }
+    std::cout << '\n';
+
+    auto write_response = fxordermgmt::FXParameterSweep::write_results_table(options.report_file, summary.value());
+    if (! write_response)
+    {
+        print_error(write_response.error());
+        return 1;
+    }
+    return 0;
+}
+
+}// namespace
+
+int main(int argc, char* argv[])
+{
+    fxordermgmt::FXBacktestOptions options;
+    if (! fxordermgmt::validateBacktestParameters(argc, argv, options))
+    {
+        return 1;
+    }
+    // ------------------
+    std::vector<std::filesystem::path> files;
+    if (std::filesystem::is_directory(options.data_path))
+    {
+        for (auto const& entry : std::filesystem::directory_iterator(options.data_path))
+        {
+            if (entry.path().extension() == ".csv" || entry.path().extension() == ".fxbars")
+            {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+    }
+    else
+    {
+        files.push_back(options.data_path);
+    }
+
+    // Bars are Loaded Once & Shared Read-Only by Every Run
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<std::expected<fxordermgmt::FXBarHistory, fxordermgmt::FXException>> histories(files.size());
+    fxordermgmt::FXTaskPool::parallel_for(
+        files.size(), options.max_threads, [&](std::size_t x) { histories[x] = load_bars(files[x], options.convert_to_binary); });
+
+    std::vector<std::string> symbols;
+    std::vector<fxordermgmt::FXBarHistory> bar_data;
+    for (std::size_t x = 0; x < files.size(); ++x)
+    {
+        if (! histories[x])
+        {
+            print_error(histories[x].error());
+            return 1;
+        }
+        symbols.push_back(symbol_from_path(files[x]));
+        bar_data.push_back(std::move(histories[x].value()));
+    }
+    // ------------------
+    if (options.sweep_mode())
+    {
+        return run_sweep(options, symbols, bar_data, start);
+    }
+
+    // Symbols are Independent | One Model Instance & Position per Symbol
+    std::vector<std::expected<fxordermgmt::FXBacktestResult, fxordermgmt::FXException>> responses(files.size());
+    fxordermgmt::FXTaskPool::parallel_for(files.size(), options.max_threads,
+        [&](std::size_t x) { responses[x] = fxordermgmt::FXBacktester::run(symbols[x], bar_data[x], options.config); });
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+    std::vector<fxordermgmt::FXBacktestResult> results;
+    std::size_t total_bars = 0;
+    for (auto& response : responses)
+    {
+        if (! response)
+        {
+            print_error(response.error());
+            return 1;
+        }
+        total_bars += response.value().bars_processed;
+        results.push_back(std::move(response.value()));
+    }
+    // ------------------
+    std::print(std::cout, "{:<10} {:>10} {:>8} {:>8} {:>14} {:>14}\n", "Symbol", "Bars", "Orders", "Win %", "Profit", "Max Drawdown");
+    for (auto const& result : results)
+    {
+        std::print(std::cout, "{:<10} {:>10} {:>8} {:>8.2f} {:>14.2f} {:>14.2f}\n", result.symbol, result.bars_processed, result.order_count,
+            win_percent(result), result.realized_profit + result.unrealized_profit, result.max_drawdown);
+    }
+    std::print(std::cout, "Replayed {} Bars in {:.2f} Seconds\n", total_bars, elapsed.count());
+
+    auto report_response =
+        fxordermgmt::FXBacktester::write_report(options.report_file, fxordermgmt::FXBacktester::build_report(results, options.config));
+    if (! report_response)
+    {
+        print_error(report_response.error());
+        return 1;
+    }
+    // -------------------
+    return 0;
+}
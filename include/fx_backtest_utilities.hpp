@@ -0,0 +1,125 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <unistd.h>// for optarg, getopt
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <iostream>   // for operator<<, basic_ostream, cout
+#include <print>      // for print
+#include <stdexcept>  // for invalid_argument, out_of_range
+#include <string>     // for string, stod, stoi, stoul
+#include <string_view>// for string_view
+#include <thread>     // for thread
+
+#include "fx_backtester.h"            // for FXBacktestConfig
+#include "fx_trading_model_registry.h"// for FXTradingModelRegistry
+
+namespace fxordermgmt
+{
+
+struct FXBacktestOptions
+{
+    std::string data_path, report_file = "interface_files/reports/FX_Backtest_Report.json";
+    bool convert_to_binary = false;
+    FXBacktestConfig config;
+    // Parameter Sweep Mode | Enabled by -g or -u
+    std::string sweep_grid, sweep_spans;
+    std::size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+
+    [[nodiscard]] bool sweep_mode() const noexcept { return ! sweep_grid.empty() || ! sweep_spans.empty(); }
+};
+
+// "Key=Value,Key=Value" -> Model Parameters
+[[nodiscard]] bool parse_model_parameters(std::string_view text, FXModelParameters& parameters)
+{
+    while (! text.empty())
+    {
+        std::size_t const comma = text.find(',');
+        std::string_view const pair = text.substr(0, comma);
+        std::size_t const equals = pair.find('=');
+        if (equals == std::string_view::npos || ! equals)
+        {
+            std::cout << "Model Parameters Must Be Key=Value Pairs Separated by Commas\n";
+            return false;
+        }
+        parameters[std::string(pair.substr(0, equals))] = std::stod(std::string(pair.substr(equals + 1)));
+        text = (comma == std::string_view::npos) ? std::string_view {} : text.substr(comma + 1);
+    }
+    return true;
+}
+
+[[nodiscard]] bool validateBacktestParameters(int argc, char* argv[], FXBacktestOptions& options)
+{
+    std::string_view const usage = "Flags are -d [Bar File or Directory] -m [Model] -p [Key=Value,...] -n [Num Data Points] "
+                                   "-q [Order Size] -x [Position Multiplier] -s [Spread] -l [Slippage] -i [Initial Funds] -o [Report File] "
+                                   "-c [Convert CSV to Binary] -g [Key=1|2|3,Key=start:stop:step] -u [MINUTE:1,5;HOUR:1 or ALL] -t [Threads]\n";
+    int c;
+    bool report_file_set = false;
+    try
+    {
+        while ((c = getopt(argc, argv, "d:m:p:n:q:x:s:l:i:o:cg:u:t:")) != -1)
+        {
+            switch (c)
+            {
+            case 'd': options.data_path = optarg; break;
+            case 'm': options.config.model_config.model_name = optarg; break;
+            case 'p': {
+                if (! parse_model_parameters(optarg, options.config.model_config.parameters))
+                {
+                    return false;
+                }
+                break;
+            }
+            case 'n': options.config.num_data_points = std::stoul(optarg); break;
+            case 'q': options.config.order_position_size = std::stoi(optarg); break;
+            case 'x': options.config.position_multiplier = std::stoi(optarg); break;
+            case 's': options.config.spread = std::stod(optarg); break;
+            case 'l': options.config.slippage = std::stod(optarg); break;
+            case 'i': options.config.initial_funds = std::stod(optarg); break;
+            case 'o': {
+                options.report_file = optarg;
+                report_file_set = true;
+                break;
+            }
+            case 'c': options.convert_to_binary = true; break;
+            case 'g': options.sweep_grid = optarg; break;
+            case 'u': options.sweep_spans = optarg; break;
+            case 't': options.max_threads = std::max(1UL, std::stoul(optarg)); break;
+            default: std::cout << "Incorrect Argument. " << usage; return false;
+            }
+        }
+    }
+    catch (std::logic_error const& e)
+    {
+        std::cout << "Provide a Number for -" << static_cast<char>(c) << ". " << e.what() << '\n';
+        return false;
+    }
+    if (options.data_path.empty())
+    {
+        std::cout << "Missing Bar Data. " << usage;
+        return false;
+    }
+    if (! FXTradingModelRegistry::instance().contains(options.config.model_config.model_name))
+    {
+        std::cout << "Trading Model '" << options.config.model_config.model_name << "' Not Registered\n";
+        return false;
+    }
+    if (options.sweep_mode())
+    {
+        options.sweep_spans = (options.sweep_spans.empty()) ? "MINUTE:1" : options.sweep_spans;
+        options.report_file = (report_file_set) ? options.report_file : "interface_files/reports/FX_Sweep_Results.csv";
+    }
+    std::print(std::cout, "Bar Data: {}, Model: {}, Num Data Points: {}, Order Size: {}, Spread: {}, Slippage: {}\n", options.data_path,
+        options.config.model_config.model_name, options.config.num_data_points, options.config.order_position_size, options.config.spread,
+        options.config.slippage);
+    if (options.sweep_mode())
+    {
+        std::print(std::cout, "Sweep Grid: {}, Spans: {}, Threads: {}\n", (options.sweep_grid.empty()) ? "None" : options.sweep_grid,
+            options.sweep_spans, options.max_threads);
+    }
+    // -------------------
+    return true;
+}
+
+}// namespace fxordermgmt
@@ -0,0 +1,77 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_BACKTESTER_H
+#define FX_BACKTESTER_H
+
+#include <cstddef> // for size_t
+#include <cstdint> // for int64_t
+#include <expected>// for expected
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include "json/json.hpp"// for json
+
+#include "fx_bar_series.h"            // for fx_price_t
+#include "fx_exception.h"             // for FXException
+#include "fx_trade_rules.h"           // for FXPosition
+#include "fx_trading_model_registry.h"// for FXModelConfig
+
+namespace fxordermgmt
+{
+
+// Complete Column Store of Historical Bars | Oldest to Newest, Epoch Seconds
+struct FXBarHistory
+{
+    std::vector<std::int64_t> date_time;
+    std::vector<fx_price_t> open, high, low, close;
+
+    [[nodiscard]] std::size_t size() const noexcept { return date_time.size(); }
+};
+
+struct FXBacktestConfig
+{
+    FXModelConfig model_config;
+    std::size_t num_data_points = 10'000;
+    int order_position_size = 1'000, position_multiplier = 1;
+    // Price Units; Buys Fill at Close + (Spread / 2 + Slippage), Sells Below
+    double spread = 0, slippage = 0;
+    double initial_funds = 100'000;
+};
+
+struct FXBacktestResult
+{
+    std::string symbol;
+    std::size_t bars_processed = 0, bars_evaluated = 0, order_count = 0, closed_trades = 0, winning_trades = 0;
+    long long traded_volume = 0;
+    double realized_profit = 0, unrealized_profit = 0, max_drawdown = 0;
+    FXPosition final_position;
+    double entry_price = 0, last_price = 0;
+    std::int64_t first_bar_time = 0, last_bar_time = 0;
+};
+
+class FXBacktester
+{
+  public:
+    // Rows: DateTime (Epoch Seconds),Open,High,Low,Close | A Non-Numeric Header Row is Skipped
+    [[nodiscard]] static std::expected<FXBarHistory, FXException> load_csv_bars(std::string const& file_name);
+
+    // Binary Column File Written by write_binary_bars (.fxbars)
+    [[nodiscard]] static std::expected<FXBarHistory, FXException> load_binary_bars(std::string const& file_name);
+
+    [[nodiscard]] static std::expected<bool, FXException> write_binary_bars(std::string const& file_name, FXBarHistory const& history);
+
+    /* Replays the history bar by bar through the configured model and the live position rules.
+       Signals start once (num_data_points) bars are loaded, the same window the live system requires. */
+    [[nodiscard]] static std::expected<FXBacktestResult, FXException> run(
+        std::string const& symbol, FXBarHistory const& history, FXBacktestConfig const& config);
+
+    // Same Layout as the Live Profitability Report
+    [[nodiscard]] static nlohmann::json build_report(std::vector<FXBacktestResult> const& results, FXBacktestConfig const& config);
+
+    [[nodiscard]] static std::expected<bool, FXException> write_report(std::string const& file_name, nlohmann::json const& report);
+};
+
+}// namespace fxordermgmt
+
+#endif
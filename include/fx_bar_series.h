@@ -0,0 +1,94 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_BAR_SERIES_H
+#define FX_BAR_SERIES_H
+
+#include <cstddef>// for size_t, byte
+#include <cstdint>// for int64_t
+#include <memory> // for unique_ptr
+#include <span>   // for span
+
+namespace fxordermgmt
+{
+
+// Select with CMake Option FX_DOUBLE_PRICES
+#ifdef FX_DOUBLE_PRICES
+using fx_price_t = double;
+#else
+using fx_price_t = float;
+#endif
+
+class FXBarSeries
+{
+  public:
+    FXBarSeries() = default;
+
+    explicit FXBarSeries(std::size_t capacity);
+
+    ~FXBarSeries() = default;
+
+    // Move ONLY | No Copy Constructor
+    FXBarSeries(FXBarSeries const& obj) = delete;
+
+    FXBarSeries& operator=(FXBarSeries const& obj) = delete;
+
+    FXBarSeries(FXBarSeries&& obj) noexcept = default;
+
+    FXBarSeries& operator=(FXBarSeries&& obj) noexcept = default;
+
+    // Timestamps are Epoch Seconds
+    void push_back(fx_price_t open, fx_price_t high, fx_price_t low, fx_price_t close, std::int64_t date_time) noexcept;
+
+    // Overwrites the Newest Bar's Prices | True When Any of Them Changed
+    bool replace_back(fx_price_t open, fx_price_t high, fx_price_t low, fx_price_t close) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    [[nodiscard]] bool full() const noexcept;
+
+    // Columns are Ordered Oldest to Newest & Always Contiguous
+    [[nodiscard]] std::span<fx_price_t const> open() const noexcept;
+
+    [[nodiscard]] std::span<fx_price_t const> high() const noexcept;
+
+    [[nodiscard]] std::span<fx_price_t const> low() const noexcept;
+
+    [[nodiscard]] std::span<fx_price_t const> close() const noexcept;
+
+    [[nodiscard]] std::span<std::int64_t const> date_time() const noexcept;
+
+  private:
+    struct AlignedDelete
+    {
+        void operator()(std::byte* ptr) const noexcept;
+    };
+
+    enum Column : std::size_t
+    {
+        OPEN,
+        HIGH,
+        LOW,
+        CLOSE,
+        PRICE_COLUMN_COUNT
+    };
+
+    /* Price columns followed by the timestamp column in one block. Each column holds (2) copies
+       of the ring so the most recent bars can always be viewed as a single contiguous span */
+    std::unique_ptr<std::byte[], AlignedDelete> data;
+    std::size_t bar_capacity = 0, column_stride = 0, write_index = 0, bar_count = 0;
+
+    [[nodiscard]] fx_price_t* price_column(Column col) const noexcept;
+
+    [[nodiscard]] std::int64_t* date_time_column() const noexcept;
+
+    [[nodiscard]] std::size_t view_start() const noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,67 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_CONTROL_CHANNEL_H
+#define FX_CONTROL_CHANNEL_H
+
+#include <expected>   // for expected
+#include <functional> // for function
+#include <optional>   // for optional
+#include <string>     // for string
+#include <string_view>// for string_view
+#include <vector>     // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+struct FXControlCommand
+{
+    bool close_all = false;
+    std::vector<std::string> symbols;
+};
+
+/* Out-of-band commands over a Unix domain socket. Each connection sends one line,
+   "CLOSE ALL" or "CLOSE <SYMBOL> [<SYMBOL> ...]", and receives "OK" or "ERROR <reason>".
+   A command naming a symbol that is not managed is answered with an error and dropped. */
+class FXControlChannel
+{
+  public:
+    FXControlChannel() = default;
+
+    // Closes the Socket & Removes its Path
+    ~FXControlChannel();
+
+    // Move ONLY | No Copy Constructor
+    FXControlChannel(FXControlChannel const& obj) = delete;
+
+    FXControlChannel& operator=(FXControlChannel const& obj) = delete;
+
+    FXControlChannel(FXControlChannel&& obj) noexcept;
+
+    FXControlChannel& operator=(FXControlChannel&& obj) noexcept;
+
+    // Fails While Another Instance Listens at (path); Replaces a Stale Socket; Only the Owner May Connect
+    [[nodiscard]] std::expected<bool, FXException> listen(std::string const& path);
+
+    [[nodiscard]] bool is_listening() const noexcept;
+
+    // Accepts Every Pending Connection Without Blocking on the Listener & Answers Each One
+    [[nodiscard]] std::vector<FXControlCommand> receive(std::function<bool(std::string_view)> const& is_managed_symbol);
+
+    // Readable Whenever a Connection is Pending
+    [[nodiscard]] int native_handle() const noexcept;
+
+    [[nodiscard]] static std::optional<FXControlCommand> parse_command(std::string_view line);
+
+  private:
+    int listen_fd = -1;
+    std::string socket_path;
+
+    void close_channel() noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_EVENT_LOOP_H
+#define FX_EVENT_LOOP_H
+
+#include <atomic>    // for atomic
+#include <chrono>    // for system_clock, milliseconds
+#include <expected>  // for expected
+#include <functional>// for function
+#include <signal.h>  // for sigset_t
+#include <utility>   // for pair
+#include <vector>    // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+/* Central wait for the trading thread, built on epoll. Deadlines are absolute wall clock times
+   armed on a timerfd, so waits end on the bar boundary itself rather than after a rounded
+   sleep. SIGINT & SIGTERM arrive through a signalfd and end the current wait early. */
+class FXEventLoop
+{
+  public:
+    FXEventLoop() = default;
+
+    // Restores the Signal Mask
+    ~FXEventLoop();
+
+    // Move ONLY | No Copy Constructor
+    FXEventLoop(FXEventLoop const& obj) = delete;
+
+    FXEventLoop& operator=(FXEventLoop const& obj) = delete;
+
+    FXEventLoop(FXEventLoop&& obj) noexcept;
+
+    FXEventLoop& operator=(FXEventLoop&& obj) noexcept;
+
+    // Blocks SIGINT & SIGTERM on the Calling Thread | Call Before Starting Other Threads so They Inherit the Mask
+    [[nodiscard]] std::expected<bool, FXException> initialize();
+
+    [[nodiscard]] bool is_initialized() const noexcept;
+
+    // (handler) Runs on the Waiting Thread While (fd) is Readable; Sources Must Outlive the Loop's Use of Them
+    [[nodiscard]] std::expected<bool, FXException> add_source(int fd, std::function<void()> handler);
+
+    // === | Each Returns False When a Shutdown Woke it Early or Was Already Requested | ===
+
+    // Returns After the First Round of Dispatched Sources, or at (deadline) | Inside a Handler it Behaves as wait_for()
+    bool run_once(std::chrono::system_clock::time_point deadline);
+
+    // Sources Stay Pending for the Next run_once()
+    bool wait_for(std::chrono::milliseconds duration);
+
+    // Safe from Any Thread
+    void request_shutdown() noexcept;
+
+    [[nodiscard]] bool shutdown_requested() const noexcept;
+
+  private:
+    // (run_epoll_fd) Holds the Sources; (wait_epoll_fd) Only the Timer, Signals & Wake-Up
+    int run_epoll_fd = -1, wait_epoll_fd = -1, timer_fd = -1, signal_fd = -1, wake_fd = -1;
+    sigset_t previous_mask {};
+    bool signals_blocked = false;
+    std::vector<std::pair<int, std::function<void()>>> sources;
+    std::atomic<bool> shutdown {false};
+    bool dispatching = false;
+
+    bool wait(std::chrono::system_clock::time_point deadline, bool dispatch_sources);
+
+    void arm_timer(std::chrono::system_clock::time_point deadline) noexcept;
+
+    void close_all() noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_FETCH_POOL_H
+#define FX_FETCH_POOL_H
+
+#include <condition_variable>// for condition_variable
+#include <cstddef>           // for size_t
+#include <deque>             // for deque
+#include <expected>          // for expected
+#include <functional>        // for function
+#include <mutex>             // for mutex
+#include <thread>            // for thread
+#include <utility>           // for pair
+#include <vector>            // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+/* Runs blocking requests on a fixed set of worker threads without waiting for them.
+   Each finished request's id is queued & an eventfd is signalled, so the trading thread
+   can pick up results from its event loop as each one arrives rather than all at once. */
+class FXFetchPool
+{
+  public:
+    FXFetchPool() = default;
+
+    // Queued Requests are Dropped; Running Requests Finish Before the Join
+    ~FXFetchPool();
+
+    FXFetchPool(FXFetchPool const& obj) = delete;
+
+    FXFetchPool& operator=(FXFetchPool const& obj) = delete;
+
+    // Call After the Event Loop is Initialized so Workers Inherit its Signal Mask
+    [[nodiscard]] std::expected<bool, FXException> start(std::size_t max_concurrency);
+
+    // (request) Must Not Throw
+    void submit(std::size_t id, std::function<void()> request);
+
+    // Ids Finished Since the Last Call, in Completion Order
+    [[nodiscard]] std::vector<std::size_t> take_completed();
+
+    // Readable While Finished Ids are Waiting
+    [[nodiscard]] int native_handle() const noexcept;
+
+  private:
+    std::mutex mutex;
+    std::condition_variable request_ready;
+    std::deque<std::pair<std::size_t, std::function<void()>>> queued_requests;
+    std::vector<std::size_t> completed_ids;
+    bool stopping = false;
+    int completion_fd = -1;
+    std::vector<std::thread> workers;
+
+    void run();
+};
+
+}// namespace fxordermgmt
+
+#endif
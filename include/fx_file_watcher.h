@@ -0,0 +1,53 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_FILE_WATCHER_H
+#define FX_FILE_WATCHER_H
+
+#include <expected>// for expected
+#include <string>  // for string
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+/* Reports changes to one file through inotify. The parent directory is watched rather than
+   the file itself, so editors that save by writing a new file and renaming it are still seen. */
+class FXFileWatcher
+{
+  public:
+    FXFileWatcher() = default;
+
+    ~FXFileWatcher();
+
+    // Move ONLY | No Copy Constructor
+    FXFileWatcher(FXFileWatcher const& obj) = delete;
+
+    FXFileWatcher& operator=(FXFileWatcher const& obj) = delete;
+
+    FXFileWatcher(FXFileWatcher&& obj) noexcept;
+
+    FXFileWatcher& operator=(FXFileWatcher&& obj) noexcept;
+
+    // The Directory Must Exist; the File Need Not
+    [[nodiscard]] std::expected<bool, FXException> watch(std::string const& file_path);
+
+    [[nodiscard]] bool is_watching() const noexcept;
+
+    // Drains Pending Events Without Blocking; True When the File Was Written, Replaced, or Removed
+    [[nodiscard]] bool changed();
+
+    // Readable Whenever Events are Pending
+    [[nodiscard]] int native_handle() const noexcept;
+
+  private:
+    int inotify_fd = -1;
+    std::string file_name;
+
+    void close_watch() noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_INDICATORS_H
+#define FX_INDICATORS_H
+
+#include <cstddef> // for size_t
+#include <expected>// for expected
+#include <span>    // for span
+
+#include "fx_bar_series.h"// for fx_price_t
+#include "fx_exception.h" // for FXException
+
+namespace fxordermgmt
+{
+
+/* Indicators over FXBarSeries columns. Every output span is the same length as the input,
+   entries before the first complete window are NaN, and outputs must not overlap inputs.
+   Only element-wise steps (window deltas, bar changes, true range, square roots, band offsets)
+   use std::experimental::simd when available. Running sums and the EMA & Wilder recurrences
+   depend on the previous bar, so they are serial loops accumulated in double. */
+class FXIndicators
+{
+  public:
+    [[nodiscard]] static std::expected<bool, FXException> sma(
+        std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out);
+
+    // Seeded with the SMA of the first (period) values
+    [[nodiscard]] static std::expected<bool, FXException> ema(
+        std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out);
+
+    // Population Standard Deviation
+    [[nodiscard]] static std::expected<bool, FXException> rolling_stdev(
+        std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out);
+
+    // (Value - Mean) / Stdev of the Trailing Window; 0 for a Flat Window
+    [[nodiscard]] static std::expected<bool, FXException> zscore(
+        std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out);
+
+    // Wilder Smoothing; First Value at Index (period)
+    [[nodiscard]] static std::expected<bool, FXException> rsi(
+        std::span<fx_price_t const> close, std::size_t period, std::span<fx_price_t> out);
+
+    // Wilder Smoothing of True Range; First Value at Index (period - 1)
+    [[nodiscard]] static std::expected<bool, FXException> atr(std::span<fx_price_t const> high, std::span<fx_price_t const> low,
+        std::span<fx_price_t const> close, std::size_t period, std::span<fx_price_t> out);
+
+    [[nodiscard]] static std::expected<bool, FXException> bollinger(std::span<fx_price_t const> values, std::size_t period,
+        fx_price_t num_stdev, std::span<fx_price_t> upper, std::span<fx_price_t> middle, std::span<fx_price_t> lower);
+
+    // MACD Line = EMA(fast) - EMA(slow); Signal Line = EMA(signal) of the MACD Line
+    [[nodiscard]] static std::expected<bool, FXException> macd(std::span<fx_price_t const> values, std::size_t fast_period,
+        std::size_t slow_period, std::size_t signal_period, std::span<fx_price_t> macd_line, std::span<fx_price_t> signal_line,
+        std::span<fx_price_t> histogram);
+
+    // Streaming Verification | Relative Tolerance for Differing Summation Order; NaN Matches NaN
+    [[nodiscard]] static bool values_match(fx_price_t streaming_value, fx_price_t batch_value) noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -13,6 +13,8 @@
 namespace fxordermgmt
 {
 
+class FXEventLoop;
+
 class FXMarketTime
 {
 
@@ -23,8 +25,12 @@ class FXMarketTime
 
     FXMarketTime(int start_hr, int end_hr, int update_frequency_seconds) noexcept;
 
+    // False When a Shutdown Was Requested While Waiting
     [[nodiscard]] std::expected<bool, FXException> wait_till_forex_market_is_open();
 
+    // Waits Run on (loop) so Shutdown Signals Can End Them | Sleeps When Unset
+    void set_event_loop(FXEventLoop* loop) noexcept;
+
     [[nodiscard]] int seconds_till_market_is_open(int start_days_adjustment, int end_days_adjustment);
 
     [[nodiscard]] int seconds_till_market_open_tomorrow(int& adjustment_seconds, int& start_days_adjustment, int& end_days_adjustment);
@@ -42,6 +48,9 @@ class FXMarketTime
   private:
     int start_hr, end_hr, update_frequency_seconds;
     bool fx_market_time_testing = false;
+    FXEventLoop* event_loop = nullptr;
+
+    [[nodiscard]] bool shutdown_requested() const noexcept;
 
     void set_timezone_offset();
 
@@ -0,0 +1,97 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_ORDER_BOOK_H
+#define FX_ORDER_BOOK_H
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint8_t
+#include <optional>     // for optional
+#include <unordered_map>// for unordered_map
+#include <vector>       // for vector
+
+#include "json/json.hpp"// for json
+
+#include "fx_order_intent.h"// for FXOrderIntent, FXOrderSubmission, fx_symbol_id_t
+
+namespace fxordermgmt
+{
+
+enum class FXOrderState : std::uint8_t
+{
+    PENDING,
+    WORKING,
+    PARTIALLY_FILLED,
+    FILLED,
+    CANCELLED,
+    REJECTED,
+    UNKNOWN
+};
+
+struct FXTrackedOrder
+{
+    std::int64_t order_id = 0;
+    FXOrderIntent intent;
+    FXOrderState state = FXOrderState::PENDING;
+    int filled_quantity = 0;
+};
+
+/* In-memory lifecycle of submitted orders keyed by OrderId. States only move forward
+   (Pending -> Working -> Partially Filled -> Filled / Cancelled / Rejected / Unknown), and
+   the unfilled, signed quantity of every live order is kept per symbol id. */
+class FXOrderBook
+{
+  public:
+    // Only Accepted Submissions Have an OrderId to Track; Returns False Otherwise
+    bool submit(FXOrderSubmission const& submission);
+
+    /* Fills (submission) from a Gain Capital ApiTradeOrderResponseDTO. The top level "Status" is the
+       instruction status (1 Accepted, 2 Red Card, 3 Yellow Card, 4 Error, 5 Pending), not an order
+       state, so acceptance comes from "OrderId" (0 When No Order Was Created) & the order's own
+       entry in "Orders[]", whose "StatusId" / "Status" uses the order StatusId values below.
+       Once that status shows the order executed (Open 3 / Closed 9), its "Quantity" is the
+       filled amount; less than the intent's quantity is a partial fill. */
+    static void read_trade_response(nlohmann::json const& response, FXOrderSubmission& submission);
+
+    // Gain Capital StatusId -> State; Major Errors (6, 8, 10) & Unknown Ids Have No State
+    [[nodiscard]] static std::optional<FXOrderState> state_from_status(int status_id) noexcept;
+
+    [[nodiscard]] static bool is_terminal(FXOrderState state) noexcept;
+
+    // Each Returns False for an Unknown Order or a Backwards Transition
+    bool apply_status(std::int64_t order_id, int status_id);
+
+    // (filled_quantity) is Cumulative; Partially Filled Until it Reaches the Order's Quantity
+    bool apply_fill(std::int64_t order_id, int filled_quantity);
+
+    bool transition(std::int64_t order_id, FXOrderState state);
+
+    /* An order leaves the active order list once filled, but also once rejected, cancelled or
+       expired; its outcome is Unknown until the open positions confirm it. Returns those orders. */
+    std::vector<std::int64_t> mark_unlisted_orders(std::vector<std::int64_t> const& listed_order_ids);
+
+    [[nodiscard]] FXTrackedOrder const* find(std::int64_t order_id) const;
+
+    // Buys Positive, Sells Negative
+    [[nodiscard]] int outstanding_exposure(fx_symbol_id_t symbol_id) const noexcept;
+
+    [[nodiscard]] std::size_t working_orders() const noexcept;
+
+    // Every Non-Terminal Order | Cancelled at the Fill Deadline so a Retry Never Stacks on a Live Order
+    [[nodiscard]] std::vector<std::int64_t> live_order_ids() const;
+
+    void clear_terminal_orders();
+
+  private:
+    std::unordered_map<std::int64_t, FXTrackedOrder> orders;
+    std::vector<int> symbol_exposure;
+    std::size_t live_orders = 0;
+
+    [[nodiscard]] static int signed_remaining(FXTrackedOrder const& order) noexcept;
+
+    void update(FXTrackedOrder& order, FXOrderState state, int filled_quantity);
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_ORDER_EXECUTOR_H
+#define FX_ORDER_EXECUTOR_H
+
+#include <chrono>  // for milliseconds
+#include <cstddef> // for size_t
+#include <expected>// for expected
+#include <vector>  // for vector
+
+#include "fx_exception.h"    // for FXException
+#include "fx_order_book.h"   // for FXOrderBook
+#include "fx_order_gateway.h"// for IOrderGateway
+#include "fx_order_intent.h" // for FXOrderIntent, FXOrderSubmission, FXSymbolTable
+
+namespace fxordermgmt
+{
+
+// Fill Confirmation Polling | Backoff Doubles Up to the Max Interval
+struct FXExecutionTiming
+{
+    std::chrono::milliseconds fill_poll_initial_interval {100};
+    std::chrono::milliseconds fill_poll_max_interval {1000};
+    std::chrono::milliseconds fill_confirmation_deadline {5000};
+};
+
+/* Sends order intents in rounds: submit, confirm fills through the active order list, then
+   resize each intent to what is still unfilled. The order book sizes the next round; open
+   positions are only downloaded when an order's outcome is unknown. */
+class FXOrderExecutor
+{
+  public:
+    // Initial Submission Plus Up to (3) Retries of the Unfilled Remainder
+    static constexpr int MAX_EXECUTION_ROUNDS = 4;
+
+    FXOrderExecutor(IOrderGateway& gateway, FXSymbolTable const& symbol_table, FXExecutionTiming timing = {});
+
+    // Leaves the Intents Still Unmet After the Last Round; Each Round Has At Most (max_concurrent_orders) Orders in Flight
+    [[nodiscard]] std::expected<bool, FXException> execute(std::vector<FXOrderIntent>& order_intents, std::size_t max_concurrent_orders);
+
+    [[nodiscard]] FXOrderBook const& orders() const noexcept;
+
+  private:
+    IOrderGateway& gateway;
+    FXSymbolTable const& symbol_table;
+    FXExecutionTiming timing;
+    FXOrderBook order_book;
+
+    [[nodiscard]] std::vector<FXOrderSubmission> submit_orders(std::vector<FXOrderIntent> const& order_intents, std::size_t max_concurrent_orders);
+
+    // Polls Until No Submitted Order is Still Working; Orders Still Live at the Deadline are Cancelled
+    [[nodiscard]] std::expected<bool, FXException> monitor_active_orders();
+
+    // Resizes Each Intent to Its Unfilled Remainder, Less Any Quantity Still Live in the Book
+    void resize_from_order_book(std::vector<FXOrderIntent>& order_intents, std::vector<FXOrderSubmission> const& submissions) const;
+
+    // Leaves Only the Intents Whose Positions Still Differ from the Target, Resized to the Remaining Quantity
+    [[nodiscard]] std::expected<bool, FXException> verify_trades_opened(std::vector<FXOrderIntent>& order_intents);
+};
+
+}// namespace fxordermgmt
+
+#endif
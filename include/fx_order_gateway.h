@@ -0,0 +1,52 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_ORDER_GATEWAY_H
+#define FX_ORDER_GATEWAY_H
+
+#include <chrono>  // for milliseconds
+#include <cstdint> // for int64_t
+#include <expected>// for expected
+
+#include "json/json.hpp"// for json
+
+#include "fx_exception.h"   // for FXException
+#include "fx_order_intent.h"// for FXOrderIntent, fx_symbol_id_t
+
+namespace fxordermgmt
+{
+
+/* Broker calls made while executing orders. FXOrderManagement implements them over the Gain
+   Capital client; tests substitute a scripted fake. Only trade_order() is called from several
+   threads at once, every other call comes from the executing thread. */
+class IOrderGateway
+{
+  public:
+    virtual ~IOrderGateway() = default;
+
+    // False When the Market ID Can't be Resolved; the Symbol's Order is Then Not Submitted
+    [[nodiscard]] virtual bool resolve_market_id(fx_symbol_id_t symbol_id) = 0;
+
+    // Market Order | ApiTradeOrderResponseDTO
+    [[nodiscard]] virtual std::expected<nlohmann::json, FXException> trade_order(FXOrderIntent const& intent) = 0;
+
+    // {"ActiveOrders": [{"TradeOrder": {"OrderId": 1, "StatusId": 2}}]}
+    [[nodiscard]] virtual std::expected<nlohmann::json, FXException> list_active_orders() = 0;
+
+    [[nodiscard]] virtual std::expected<nlohmann::json, FXException> cancel_order(std::int64_t order_id) = 0;
+
+    // Downloads Only When the Snapshot Has Been Invalidated
+    [[nodiscard]] virtual std::expected<bool, FXException> load_open_positions() = 0;
+
+    virtual void invalidate_open_positions() noexcept = 0;
+
+    // The "OpenPositions" Array from the Last Download
+    [[nodiscard]] virtual nlohmann::json const& open_positions() const noexcept = 0;
+
+    // Pause Between Active Order Polls | False When a Shutdown Cut it Short
+    virtual bool wait_for(std::chrono::milliseconds duration) = 0;
+};
+
+}// namespace fxordermgmt
+
+#endif
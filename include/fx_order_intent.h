@@ -0,0 +1,91 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_ORDER_INTENT_H
+#define FX_ORDER_INTENT_H
+
+#include <chrono>       // for microseconds
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint8_t, uint32_t
+#include <functional>   // for equal_to
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view, hash
+#include <unordered_map>// for unordered_map
+#include <vector>       // for vector
+
+#include "fx_trade_rules.h"// for FXTradeDecision, FXTradeRules
+
+namespace fxordermgmt
+{
+
+using fx_symbol_id_t = std::uint32_t;
+
+enum class FXOrderSide : std::uint8_t
+{
+    BUY,
+    SELL
+};
+
+// Order to Send for One Symbol; Converted to JSON Only at the Gain Capital Boundary
+struct FXOrderIntent
+{
+    fx_symbol_id_t symbol_id = 0;
+    FXOrderSide side = FXOrderSide::BUY;
+    int quantity = 0;
+    int final_quantity = 0;
+
+    [[nodiscard]] static FXOrderIntent from_decision(fx_symbol_id_t symbol_id, FXTradeDecision const& decision) noexcept;
+
+    [[nodiscard]] static constexpr char const* side_name(FXOrderSide side) noexcept
+    {
+        return FXTradeRules::direction_name(side == FXOrderSide::BUY);
+    }
+
+    [[nodiscard]] static std::optional<FXOrderSide> parse_side(std::string_view direction) noexcept;
+
+    [[nodiscard]] static FXOrderSide opposite(FXOrderSide side) noexcept;
+};
+
+// Gain Capital Response for One Submitted Intent; (status_id) Uses the Order StatusId Values
+struct FXOrderSubmission
+{
+    FXOrderIntent intent;
+    std::int64_t order_id = 0;
+    int status_id = 0;
+    int filled_quantity = 0;
+    bool accepted = false;
+    // Sent, but No Response Was Read | The Order May Exist Without an OrderId
+    bool unconfirmed = false;
+    std::chrono::microseconds latency {0};
+    std::string error_message;
+};
+
+// Symbols are Interned Once; Ids are Dense & Stable for the Life of the Table
+class FXSymbolTable
+{
+  public:
+    fx_symbol_id_t intern(std::string_view symbol);
+
+    [[nodiscard]] std::optional<fx_symbol_id_t> find(std::string_view symbol) const;
+
+    [[nodiscard]] std::string const& name(fx_symbol_id_t symbol_id) const;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+
+  private:
+    // Transparent | Lookups by std::string_view Build No std::string
+    struct SymbolHash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(std::string_view symbol) const noexcept { return std::hash<std::string_view> {}(symbol); }
+    };
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, fx_symbol_id_t, SymbolHash, std::equal_to<>> ids;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -4,30 +4,53 @@
 #ifndef FX_ORDER_MANAGEMENT_H
 #define FX_ORDER_MANAGEMENT_H
 
+#include <chrono>       // for system_clock, milliseconds
 #include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <deque>        // for deque
 #include <expected>     // for expected
+#include <memory>       // for unique_ptr
+#include <shared_mutex> // for shared_mutex
 #include <string>       // for hash, string, allocator
+#include <string_view>  // for string_view
 #include <unordered_map>// for unordered_map
 #include <vector>       // for vector
 
 #include "gain_capital_api/gain_capital_client.h"// for GCapiClient
 #include "json/json.hpp"                         // for json
 
-#include "fx_exception.h"    // for FXException
-#include "fx_market_time.h"  // for FXMarketTime
-#include "fx_trading_model.h"// for FXTradingModel
-#include "fx_utilities.h"    // for FXUtilities
+#include "fx_bar_series.h"             // for FXBarSeries
+#include "fx_control_channel.h"        // for FXControlChannel
+#include "fx_event_loop.h"             // for FXEventLoop
+#include "fx_exception.h"              // for FXException
+#include "fx_fetch_pool.h"             // for FXFetchPool
+#include "fx_file_watcher.h"           // for FXFileWatcher
+#include "fx_market_time.h"            // for FXMarketTime
+#include "fx_order_executor.h"         // for FXOrderExecutor
+#include "fx_order_gateway.h"          // for IOrderGateway
+#include "fx_order_intent.h"           // for FXOrderIntent, FXSymbolTable, fx_symbol_id_t
+#include "fx_report_worker.h"          // for FXReportWorker, FXReportSnapshot
+#include "fx_report_writer.h"          // for FXReportWriter, FXProfitReport
+#include "fx_trading_model_interface.h"// for ITradingModel
+#include "fx_trading_model_registry.h" // for FXModelConfig
+#include "fx_utilities.h"              // for FXUtilities
 
 namespace fxordermgmt
 {
 
-class FXOrderManagement
+class FXOrderManagement : private IOrderGateway
 {
   public:
     // Load User Settings
     std::vector<std::string> fx_symbols_to_trade;
     std::string trading_account, forex_api_key, update_interval;
     int start_hr, end_hr, num_data_points, update_span, order_position_size;
+    bool incremental_update = false;
+    int max_concurrent_requests = 4;
+    int max_concurrent_orders = 4;
+    bool verify_streaming_indicators = false;
+    bool bar_ready_polling = false;
+    int bar_poll_delay_ms = 250;
 
     FXOrderManagement() = default;
 
@@ -36,14 +59,14 @@ class FXOrderManagement
 
     ~FXOrderManagement() = default;
 
-    // Move ONLY | No Copy Constructor
+    // No Copy or Move | Holds a Mutex, & fx_market_time Points at the Member event_loop
     FXOrderManagement(FXOrderManagement const& obj) = delete;
 
     FXOrderManagement& operator=(FXOrderManagement const& obj) = delete;
 
-    FXOrderManagement(FXOrderManagement&& obj) noexcept = default;
+    FXOrderManagement(FXOrderManagement&& obj) = delete;
 
-    FXOrderManagement& operator=(FXOrderManagement&& obj) noexcept = default;
+    FXOrderManagement& operator=(FXOrderManagement&& obj) = delete;
 
     // === | Main Entry Points | ===
 
@@ -64,24 +87,68 @@ class FXOrderManagement
 
     // For Gain Capital
     gaincapital::GCClient session;
+    // Market ID Lookups Write the Client & Hold it Exclusively; Requests Off the Trading Thread Hold it Shared
+    std::shared_mutex session_mutex;
 
     // For Trading Indicator
-    std::unordered_map<std::string, FXTradingModel> trading_model_map;
-    std::unordered_map<std::string, std::vector<float>> open_prices_map, high_prices_map, low_prices_map, close_prices_map, datetime_map;
+    FXModelConfig default_model_config;
+    std::unordered_map<std::string, FXModelConfig> model_config_map;
 
-    // Building Trades
-    std::unordered_map<std::string, int> position_multiplier;
-    std::vector<std::string> execute_list;
+    // Per-Symbol State | Flat Arrays Indexed by FXSymbolTable Id
+    FXSymbolTable symbol_table;
+    std::vector<fx_symbol_id_t> trading_symbols;
+    std::vector<std::unique_ptr<ITradingModel>> trading_models;
+    std::vector<FXBarSeries> symbol_price_bars;
+    std::vector<int> position_multiplier;
 
-    // Getting Price History
-    std::size_t last_bar_timestamp, next_bar_timestamp;
-    std::unordered_map<std::string, int> price_update_failure_count;
-
-    // Placing Trades
-    int execution_loop_count;
+    // Building Trades | Symbols with New Bars; (execute_set) Flags the Same Ids for O(1) Membership
+    std::vector<fx_symbol_id_t> execute_list;
+    std::vector<bool> execute_set;
 
-    // Output Profit Report
-    float initial_equity;
+    // Getting Price History
+    std::size_t last_bar_timestamp = 0, next_bar_timestamp = 0;
+    std::vector<int> price_update_failure_count;
+    std::vector<std::int64_t> symbol_bar_timestamp;
+    // Milliseconds from (next_bar_timestamp) Until the Bar Was First Seen; -1 Until Observed
+    std::vector<std::int64_t> bar_publication_delay_ms;
+
+    // Per-Symbol Price Pipelines | Fetched on the Fetch Pool, Merged & Traded on the Trading Thread as Each Finishes
+    struct OHLCRequest
+    {
+        std::size_t stored_timestamp = 0, bars_missing = 0, target_timestamp = 0;
+        bool incremental = false;
+        std::expected<nlohmann::json, gaincapital::GCException> response;
+    };
+    // Deque so a Slot Never Moves While its Request is in Flight
+    std::deque<OHLCRequest> ohlc_requests;
+    std::vector<bool> fetch_in_flight, awaiting_bar;
+    std::vector<std::chrono::system_clock::time_point> next_fetch_time;
+    std::vector<std::chrono::milliseconds> poll_interval;
+    std::chrono::system_clock::time_point bar_poll_deadline {};
+    std::expected<bool, FXException> pipeline_response {true};
+    bool bars_traded = false;
+
+    // Placing Trades | Broker Calls Go Through This Object's IOrderGateway Overrides
+    FXOrderExecutor order_executor {*this, symbol_table};
+
+    // Open Positions Shared Within One Update Cycle; Invalidated by Order Activity
+    nlohmann::json open_positions_snapshot;
+    bool open_positions_current = false;
+
+    // Active Management File | Re-Read Only After the Watcher Sees a Change
+    FXFileWatcher active_management_watcher;
+    bool active_management_loaded = false;
+
+    // Unix Domain Socket for Out-of-Band Close Commands
+    FXControlChannel control_channel;
+
+    // Every Wait on the Trading Thread | Woken by Bar Deadlines, Control Commands, File Edits & Shutdown Signals
+    FXEventLoop event_loop;
+
+    // Output Profit Report | Owned by the Report Worker Thread
+    double initial_equity = 0;
+    FXProfitReport profit_report;
+    FXReportWriter report_writer;
 
     // General Use
     int update_frequency_seconds, general_error_count;
@@ -92,23 +159,63 @@ class FXOrderManagement
     bool fx_order_mgmt_testing = false;
     std::string gain_capital_testing_url, fx_mgmt_test_dir;
 
+    // Destroyed Second, After fetch_pool; Joins While the Session & Report State it Reads are Still Alive
+    std::unique_ptr<FXReportWorker> report_worker;
+
+    // Declared Last so it is Destroyed First; Running Requests Finish Before the Slots They Write Go Away
+    std::unique_ptr<FXFetchPool> fetch_pool;
+
     // === | Testing | ===
 
     [[nodiscard]] std::expected<bool, FXException> trade_order_sequence();
 
-    [[nodiscard]] std::expected<std::vector<nlohmann::json>, FXException> build_trades();
+    [[nodiscard]] std::expected<std::vector<FXOrderIntent>, FXException> build_trades();
+
+    // Closing Trades for (symbol_ids), or Every Open Position, from the Current Open Positions Snapshot
+    [[nodiscard]] std::vector<FXOrderIntent> build_exit_trades(std::vector<fx_symbol_id_t> const& symbol_ids, bool all_symbols = false);
+
+    void clear_execute_set() noexcept;
 
     void return_tick_history(std::vector<std::string> const& symbols_list);
 
-    void return_price_history(std::vector<std::string> const& symbols_list);
+    // Starts the Request Unless One is Already in Flight; Accepted Once the Bar at (target_timestamp) Has Closed
+    void dispatch_price_request(fx_symbol_id_t symbol_id, std::size_t target_timestamp);
 
+    // Merges Every Finished Request, Reschedules Polls & Retries, Then Trades the Symbols That Merged
+    void handle_price_requests();
+
+    // Returns False Only When (wait_for_publication) & the Newest Bar Still Predates the Target
+    [[nodiscard]] bool merge_price_history(fx_symbol_id_t symbol_id, bool wait_for_publication);
+
+    // Runs the Symbol Pipelines Until Each Has Merged or Failed the Next Bar | Trade Errors are Returned Here
     [[nodiscard]] std::expected<bool, FXException> pause_till_next_bar();
 
-    [[nodiscard]] std::expected<bool, FXException> execute_signals(std::vector<nlohmann::json>& trade_dict);
+    [[nodiscard]] std::chrono::milliseconds first_bar_poll_delay() const;
+
+    [[nodiscard]] std::expected<bool, FXException> execute_signals(std::vector<FXOrderIntent>& order_intents);
+
+    // Only the Trading Thread Inserts Market IDs, Under an Exclusive Lock on (session_mutex) | False When Unresolved
+    bool cache_market_id(fx_symbol_id_t symbol_id);
+
+    // === | IOrderGateway | ===
+
+    [[nodiscard]] bool resolve_market_id(fx_symbol_id_t symbol_id) override;
 
-    [[nodiscard]] std::expected<bool, FXException> monitor_active_orders();
+    // Called from the Order Workers | Holds (session_mutex) Shared
+    [[nodiscard]] std::expected<nlohmann::json, FXException> trade_order(FXOrderIntent const& intent) override;
 
-    [[nodiscard]] std::expected<bool, FXException> verify_trades_opened(std::vector<nlohmann::json>& trade_dict);
+    [[nodiscard]] std::expected<nlohmann::json, FXException> list_active_orders() override;
+
+    [[nodiscard]] std::expected<nlohmann::json, FXException> cancel_order(std::int64_t order_id) override;
+
+    // Downloads Only When the Snapshot Has Been Invalidated
+    [[nodiscard]] std::expected<bool, FXException> load_open_positions() override;
+
+    void invalidate_open_positions() noexcept override;
+
+    [[nodiscard]] nlohmann::json const& open_positions() const noexcept override;
+
+    bool wait_for(std::chrono::milliseconds duration) override;
 
     // === | Gain Capital API | ===
 
@@ -116,7 +223,10 @@ class FXOrderManagement
 
     // === | FX Trading Model | ===
 
-    void initialize_trading_model(std::string const& symbol) noexcept;
+    // Interns (symbol) & Grows Every Per-Symbol Array to Match the Symbol Table
+    fx_symbol_id_t add_symbol(std::string_view symbol);
+
+    [[nodiscard]] std::expected<bool, FXException> initialize_trading_model(fx_symbol_id_t symbol_id);
 
     // === | Forex File I/O | ===
 
@@ -124,9 +234,29 @@ class FXOrderManagement
 
     [[nodiscard]] std::expected<bool, FXException> build_filesystem_directory(std::string const& dir);
 
+    [[nodiscard]] std::string interface_directory() const;
+
+    // Starts Watching on First Use; Reads the File Only When it Has Changed
+    [[nodiscard]] std::expected<bool, FXException> update_active_management();
+
+    [[nodiscard]] std::expected<bool, FXException> handle_control_commands();
+
+    // Applies Multiples & Close Requests to In-Memory State; Writes Only to Add Missing Symbols
     [[nodiscard]] std::expected<bool, FXException> read_active_management_file();
 
+    [[nodiscard]] std::expected<bool, FXException> write_active_management_file(nlohmann::json const& data);
+
+    // Sets "Close_Position" for Symbols Closed Over the Control Channel
+    [[nodiscard]] std::expected<bool, FXException> record_close_requests(std::vector<fx_symbol_id_t> const& symbol_ids);
+
+    [[nodiscard]] std::expected<bool, FXException> close_positions(std::vector<fx_symbol_id_t> const& symbol_ids, bool all_symbols = false);
+
+    // Snapshots Positions on the Trading Thread & Hands Them to the Report Worker
     [[nodiscard]] std::expected<bool, FXException> output_profit_report();
+
+    /* Runs on the report worker under a shared lock on (session_mutex). The trading thread caches
+       market IDs before submission; a position whose ID is still uncached gets no price request. */
+    [[nodiscard]] std::expected<bool, FXException> write_profit_report(FXReportSnapshot const& snapshot);
 };
 
 }// namespace fxordermgmt
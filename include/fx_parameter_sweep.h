@@ -0,0 +1,70 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_PARAMETER_SWEEP_H
+#define FX_PARAMETER_SWEEP_H
+
+#include <cstddef>    // for size_t
+#include <expected>   // for expected
+#include <string>     // for string
+#include <string_view>// for string_view
+#include <vector>     // for vector
+
+#include "fx_backtester.h"             // for FXBarHistory, FXBacktestConfig, FXBacktestResult
+#include "fx_exception.h"              // for FXException
+#include "fx_trading_model_interface.h"// for FXModelParameters
+
+namespace fxordermgmt
+{
+
+// Update_Interval & Update_Span Pair Accepted by validate_user_settings
+struct FXSweepSpan
+{
+    std::string update_interval;
+    int update_span = 1;
+    int span_seconds = 60;
+};
+
+struct FXSweepResult
+{
+    FXSweepSpan span;
+    FXModelParameters parameters;
+    FXBacktestResult result;
+    double total_profit = 0;
+};
+
+struct FXSweepSummary
+{
+    // Ranked by Total Profit, then Lowest Max Drawdown
+    std::vector<FXSweepResult> results;
+    std::size_t skipped_jobs = 0;
+    std::string first_skip_reason;
+};
+
+class FXParameterSweep
+{
+  public:
+    // "Key=1|2|3,Key=start:stop:step" -> Cartesian Product of Every Value
+    [[nodiscard]] static std::expected<std::vector<FXModelParameters>, FXException> parse_parameter_grid(std::string_view grid);
+
+    // "MINUTE:1,5,15;HOUR:1,4" or "ALL"; Spans Must Appear in FXUtilities::SPAN_M / SPAN_H
+    [[nodiscard]] static std::expected<std::vector<FXSweepSpan>, FXException> parse_spans(std::string_view spans);
+
+    // Bars are Bucketed on Epoch Multiples of (span_seconds); Bar Time is the Bucket Start
+    [[nodiscard]] static std::expected<FXBarHistory, FXException> resample(FXBarHistory const& history, int span_seconds);
+
+    /* One job per (symbol x span x parameter set), scheduled with FXTaskPool::work_stealing_for.
+       Each symbol is resampled once per span and shared read-only by every job. Jobs the model
+       or history cannot run (e.g. invalid parameters, too few bars) are skipped and counted. */
+    [[nodiscard]] static std::expected<FXSweepSummary, FXException> run(std::vector<std::string> const& symbols,
+        std::vector<FXBarHistory> const& histories, std::vector<FXSweepSpan> const& spans, std::vector<FXModelParameters> const& grid,
+        FXBacktestConfig const& base_config, std::size_t max_concurrency);
+
+    [[nodiscard]] static std::string format_parameters(FXModelParameters const& parameters);
+
+    [[nodiscard]] static std::expected<bool, FXException> write_results_table(std::string const& file_name, FXSweepSummary const& summary);
+};
+
+}// namespace fxordermgmt
+
+#endif
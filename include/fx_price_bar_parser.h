@@ -0,0 +1,46 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_PRICE_BAR_PARSER_H
+#define FX_PRICE_BAR_PARSER_H
+
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t
+#include <expected>   // for expected
+#include <optional>   // for optional
+#include <string_view>// for string_view
+
+#include "json/json.hpp"// for json
+
+#include "fx_bar_series.h"// for FXBarSeries
+#include "fx_exception.h" // for FXException
+
+namespace fxordermgmt
+{
+
+struct FXPriceBarsSummary
+{
+    std::size_t bars_received = 0, bars_appended = 0, bars_revised = 0;
+    std::int64_t last_timestamp = 0;
+};
+
+class FXPriceBarParser
+{
+  public:
+    /* Typed walk over an already parsed "PriceBars" array. A bar at exactly (after_timestamp) that is
+       also the newest stored bar overwrites it, since it may have been stored while still in progress. */
+    [[nodiscard]] static std::expected<FXPriceBarsSummary, FXException> load_price_bars(
+        nlohmann::json const& price_bars_json, FXBarSeries& price_bars, std::int64_t after_timestamp = 0);
+
+    /* The first bar starting at or after (bar_timestamp) is closed once a later bar follows it, or once
+       its interval has elapsed by (timestamp_now). False when no such bar exists or a BarDate is invalid. */
+    [[nodiscard]] static bool bar_closed(
+        nlohmann::json const& price_bars_json, std::int64_t bar_timestamp, std::int64_t interval_seconds, std::int64_t timestamp_now);
+
+    // "/Date(1706745600000)/" -> 1706745600 (Epoch Seconds)
+    [[nodiscard]] static std::optional<std::int64_t> parse_bar_date(std::string_view bar_date) noexcept;
+};
+
+}// namespace fxordermgmt
+
+#endif
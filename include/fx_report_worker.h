@@ -0,0 +1,67 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_REPORT_WORKER_H
+#define FX_REPORT_WORKER_H
+
+#include <condition_variable>// for condition_variable
+#include <cstddef>           // for size_t
+#include <functional>        // for function
+#include <mutex>             // for mutex
+#include <optional>          // for optional
+#include <string>            // for string
+#include <thread>            // for thread
+#include <vector>            // for vector
+
+namespace fxordermgmt
+{
+
+struct FXReportPosition
+{
+    std::string symbol, direction;
+    double quantity = 0, entry_price = 0;
+    // Filled from a Fresh Bar Close When Available, Otherwise Requested by the Worker
+    std::optional<double> current_price;
+};
+
+// Immutable Once Submitted; Everything the Report Needs from the Trading Thread
+struct FXReportSnapshot
+{
+    std::vector<FXReportPosition> positions;
+    std::string file_name, last_updated;
+};
+
+/* Writes snapshots on its own thread. The queue holds a single pending snapshot:
+   submitting while the worker is busy replaces (drops) the older, stale one. */
+class FXReportWorker
+{
+  public:
+    explicit FXReportWorker(std::function<void(FXReportSnapshot const&)> report_writer);
+
+    // Writes the Pending Snapshot (if Any), Then Joins
+    ~FXReportWorker();
+
+    FXReportWorker(FXReportWorker const& obj) = delete;
+
+    FXReportWorker& operator=(FXReportWorker const& obj) = delete;
+
+    // Never Waits on the Write
+    void submit(FXReportSnapshot snapshot);
+
+    [[nodiscard]] std::size_t dropped_snapshots() const;
+
+  private:
+    std::function<void(FXReportSnapshot const&)> writer;
+    mutable std::mutex mutex;
+    std::condition_variable snapshot_ready;
+    std::optional<FXReportSnapshot> pending_snapshot;
+    std::size_t dropped = 0;
+    bool stopping = false;
+    std::thread worker;
+
+    void run();
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_REPORT_WRITER_H
+#define FX_REPORT_WRITER_H
+
+#include <cstddef> // for size_t
+#include <expected>// for expected
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+struct FXPositionPerformance
+{
+    std::string symbol, direction;
+    double quantity = 0, entry_price = 0, current_price = 0, profit = 0, profit_percent = 0;
+};
+
+struct FXProfitReport
+{
+    double initial_funds = 0, current_funds = 0, margin_utilized = 0, profit_cumulative = 0, profit_percent_cumulative = 0;
+    std::vector<FXPositionPerformance> positions;
+    std::string last_updated;
+};
+
+class FXReportWriter
+{
+  public:
+    FXReportWriter() = default;
+
+    /* Serializes into a reused buffer & replaces (file_name) through a temporary file and rename,
+       so readers never see a partial report. Returns false when the content, excluding
+       "Last Updated", matches the previous write and the file was left untouched. */
+    [[nodiscard]] std::expected<bool, FXException> write(std::string const& file_name, FXProfitReport const& report);
+
+    // Text of the Most Recent Serialization
+    [[nodiscard]] std::string const& contents() const noexcept;
+
+  private:
+    std::string buffer, last_file_name;
+    std::size_t last_content_hash = 0;
+    std::vector<std::size_t> position_order;
+
+    // Returns the Offset Where the Hashed Content Begins
+    std::size_t serialize(FXProfitReport const& report);
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_SMA_CROSSOVER_MODEL_H
+#define FX_SMA_CROSSOVER_MODEL_H
+
+#include <cstddef> // for size_t
+#include <cstdint> // for int64_t
+#include <expected>// for expected
+#include <vector>  // for vector
+
+#include "fx_bar_series.h"             // for FXBarSeries, fx_price_t
+#include "fx_exception.h"              // for FXException
+#include "fx_streaming_indicators.h"   // for FXStreamingSMA
+#include "fx_trading_model_interface.h"// for ITradingModel, FXModelParameters
+
+namespace fxordermgmt
+{
+
+/* Example Model | Registered as "SMA_Crossover"
+   Parameters: Fast_Period (Default 10), Slow_Period (Default 30) */
+class FXSMACrossoverModel : public ITradingModel
+{
+  public:
+    explicit FXSMACrossoverModel(FXModelParameters const& parameters);
+
+    // Buy While the Fast SMA is Above the Slow SMA; Flat Until (Slow_Period) Bars Exist
+    [[nodiscard]] int send_trading_signal(FXBarSeries const& price_bars) override;
+
+    void on_history_loaded(FXBarSeries const& price_bars) override;
+
+    void on_new_bars(FXBarSeries const& price_bars, std::size_t new_bar_count) override;
+
+    [[nodiscard]] std::expected<bool, FXException> verify_streaming_state(FXBarSeries const& price_bars) override;
+
+  private:
+    std::size_t fast_period, slow_period;
+    FXStreamingSMA fast_sma, slow_sma;
+    // Newest Bar Folded into the Streaming State
+    std::int64_t last_bar_time = 0;
+    std::vector<fx_price_t> verify_fast, verify_slow;
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,149 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_STREAMING_INDICATORS_H
+#define FX_STREAMING_INDICATORS_H
+
+#include <cstddef>// for size_t
+#include <span>   // for span
+#include <vector> // for vector
+
+#include "fx_bar_series.h"// for fx_price_t
+
+namespace fxordermgmt
+{
+
+/* Streaming counterparts of FXIndicators. seed() replays a history once, then update()
+   folds in one bar in O(1). Values are NaN until the same index FXIndicators would
+   first report, and after seeding they match the last element of the batch result. */
+
+class FXStreamingSMA
+{
+  public:
+    explicit FXStreamingSMA(std::size_t period);
+
+    void seed(std::span<fx_price_t const> values);
+
+    fx_price_t update(fx_price_t price) noexcept;
+
+    [[nodiscard]] fx_price_t value() const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    std::size_t period, next_index = 0, count = 0;
+    std::vector<fx_price_t> window;
+    double sum = 0;
+};
+
+class FXStreamingEMA
+{
+  public:
+    explicit FXStreamingEMA(std::size_t period);
+
+    void seed(std::span<fx_price_t const> values) noexcept;
+
+    fx_price_t update(fx_price_t price) noexcept;
+
+    [[nodiscard]] fx_price_t value() const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    std::size_t period, count = 0;
+    double alpha, ema = 0;
+};
+
+// Rolling Mean, Population Stdev, Z-Score & Bollinger Bands over One Window
+class FXStreamingStats
+{
+  public:
+    explicit FXStreamingStats(std::size_t period);
+
+    void seed(std::span<fx_price_t const> values);
+
+    void update(fx_price_t price) noexcept;
+
+    [[nodiscard]] fx_price_t mean() const noexcept;
+
+    [[nodiscard]] fx_price_t stdev() const noexcept;
+
+    [[nodiscard]] fx_price_t zscore() const noexcept;
+
+    [[nodiscard]] fx_price_t upper_band(fx_price_t num_stdev) const noexcept;
+
+    [[nodiscard]] fx_price_t lower_band(fx_price_t num_stdev) const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    std::size_t period, next_index = 0, count = 0;
+    std::vector<fx_price_t> window;
+    double shift = 0, sum = 0, sum_sq = 0;
+
+    [[nodiscard]] double variance() const noexcept;
+
+    void recompute_sums() noexcept;
+};
+
+class FXStreamingRSI
+{
+  public:
+    explicit FXStreamingRSI(std::size_t period);
+
+    void seed(std::span<fx_price_t const> close) noexcept;
+
+    fx_price_t update(fx_price_t close) noexcept;
+
+    [[nodiscard]] fx_price_t value() const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    std::size_t period, count = 0;
+    double previous_close = 0, average_gain = 0, average_loss = 0;
+};
+
+class FXStreamingATR
+{
+  public:
+    explicit FXStreamingATR(std::size_t period);
+
+    void seed(std::span<fx_price_t const> high, std::span<fx_price_t const> low, std::span<fx_price_t const> close) noexcept;
+
+    fx_price_t update(fx_price_t high, fx_price_t low, fx_price_t close) noexcept;
+
+    [[nodiscard]] fx_price_t value() const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    std::size_t period, count = 0;
+    double previous_close = 0, average_range = 0;
+};
+
+class FXStreamingMACD
+{
+  public:
+    FXStreamingMACD(std::size_t fast_period, std::size_t slow_period, std::size_t signal_period);
+
+    void seed(std::span<fx_price_t const> values) noexcept;
+
+    void update(fx_price_t price) noexcept;
+
+    [[nodiscard]] fx_price_t macd_line() const noexcept;
+
+    [[nodiscard]] fx_price_t signal_line() const noexcept;
+
+    [[nodiscard]] fx_price_t histogram() const noexcept;
+
+    [[nodiscard]] bool ready() const noexcept;
+
+  private:
+    FXStreamingEMA fast_ema, slow_ema, signal_ema;
+    fx_price_t macd_value;
+};
+
+}// namespace fxordermgmt
+
+#endif
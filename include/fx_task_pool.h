@@ -0,0 +1,27 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_TASK_POOL_H
+#define FX_TASK_POOL_H
+
+#include <cstddef>   // for size_t
+#include <functional>// for function
+
+namespace fxordermgmt
+{
+
+class FXTaskPool
+{
+  public:
+    /* Runs task(0) ... task(count - 1) with at most (max_concurrency) threads.
+       The calling thread participates; blocks until every task completes. */
+    static void parallel_for(std::size_t count, std::size_t max_concurrency, std::function<void(std::size_t)> const& task);
+
+    /* Tasks are dealt to workers in contiguous blocks so neighbouring tasks (e.g. jobs sharing
+       one symbol's bars) stay on one thread; an idle worker steals half of another's block. */
+    static void work_stealing_for(std::size_t count, std::size_t max_concurrency, std::function<void(std::size_t)> const& task);
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_TRADE_RULES_H
+#define FX_TRADE_RULES_H
+
+#include <optional>// for optional
+
+namespace fxordermgmt
+{
+
+// Live Position; (is_buy) is Ignored While (quantity) is 0
+struct FXPosition
+{
+    int quantity = 0;
+    bool is_buy = true;
+};
+
+struct FXTradeDecision
+{
+    int quantity = 0;
+    bool is_buy = true;
+    int final_quantity = 0;
+};
+
+// Position Logic Shared by build_trades & the Backtester
+class FXTradeRules
+{
+  public:
+    // Multiple is Applied in Whole Lots of 1000
+    [[nodiscard]] static int base_quantity(int position_multiplier, int order_position_size) noexcept;
+
+    /* Signal 1 (Buy) / -1 (Sell) tops up or reverses to (base_quantity), 0 closes the position.
+       No position opens on a non-zero signal. Empty when no order is required. */
+    [[nodiscard]] static std::optional<FXTradeDecision> decide(int signal, FXPosition const& position, int base_quantity) noexcept;
+
+    // "buy" / "sell" as Used by the Gain Capital API & the Reports | The One Copy of These Names
+    [[nodiscard]] static constexpr char const* direction_name(bool is_buy) noexcept { return (is_buy) ? "buy" : "sell"; }
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -4,27 +4,21 @@
 #ifndef FX_TRADING_MODEL_H
 #define FX_TRADING_MODEL_H
 
-#include <vector>// for vector
+#include "fx_bar_series.h"             // for FXBarSeries
+#include "fx_trading_model_interface.h"// for ITradingModel, FXModelParameters
 
 namespace fxordermgmt
 {
 
-class FXTradingModel
+// Placeholder Model | Registered as "Placeholder"
+class FXTradingModel : public ITradingModel
 {
   public:
-    FXTradingModel() = delete;
+    FXTradingModel() = default;
 
-    FXTradingModel(std::vector<float> const& open_prices, std::vector<float> const& high_prices, std::vector<float> const& low_prices,
-        std::vector<float> const& close_prices, std::vector<float> const& date_time);
+    explicit FXTradingModel(FXModelParameters const& parameters);
 
-    [[nodiscard]] int send_trading_signal();
-
-  private:
-    std::vector<float> const& open_prices;
-    std::vector<float> const& high_prices;
-    std::vector<float> const& low_prices;
-    std::vector<float> const& close_prices;
-    std::vector<float> const& date_time;
+    [[nodiscard]] int send_trading_signal(FXBarSeries const& price_bars) override;
 };
 
 }// namespace fxordermgmt
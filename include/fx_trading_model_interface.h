@@ -0,0 +1,42 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_TRADING_MODEL_INTERFACE_H
+#define FX_TRADING_MODEL_INTERFACE_H
+
+#include <cstddef>      // for size_t
+#include <expected>     // for expected
+#include <string>       // for string
+#include <unordered_map>// for unordered_map
+
+#include "fx_bar_series.h"// for FXBarSeries
+#include "fx_exception.h" // for FXException
+
+namespace fxordermgmt
+{
+
+using FXModelParameters = std::unordered_map<std::string, double>;
+
+class ITradingModel
+{
+  public:
+    virtual ~ITradingModel() = default;
+
+    // Signal: 1 (Buy), -1 (Sell), 0 (Close Position)
+    [[nodiscard]] virtual int send_trading_signal(FXBarSeries const& price_bars) = 0;
+
+    // Streaming Hooks | Called After a Full History Load, then with Only the Newest Bars
+    virtual void on_history_loaded([[maybe_unused]] FXBarSeries const& price_bars) {}
+
+    virtual void on_new_bars([[maybe_unused]] FXBarSeries const& price_bars, [[maybe_unused]] std::size_t new_bar_count) {}
+
+    // Verification Mode | Compare Streaming State Against a Full Recomputation
+    [[nodiscard]] virtual std::expected<bool, FXException> verify_streaming_state([[maybe_unused]] FXBarSeries const& price_bars)
+    {
+        return std::expected<bool, FXException> {true};
+    }
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#ifndef FX_TRADING_MODEL_REGISTRY_H
+#define FX_TRADING_MODEL_REGISTRY_H
+
+#include <expected>     // for expected
+#include <functional>   // for function
+#include <memory>       // for unique_ptr, make_unique
+#include <string>       // for string
+#include <unordered_map>// for unordered_map
+#include <vector>       // for vector
+
+#include "fx_exception.h"              // for FXException
+#include "fx_trading_model_interface.h"// for ITradingModel, FXModelParameters
+
+namespace fxordermgmt
+{
+
+using FXModelFactory = std::function<std::unique_ptr<ITradingModel>(FXModelParameters const&)>;
+
+// Loaded From 'Trading_Models' in user_settings.json
+struct FXModelConfig
+{
+    std::string model_name = "Placeholder";
+    FXModelParameters parameters;
+};
+
+class FXTradingModelRegistry
+{
+  public:
+    [[nodiscard]] static FXTradingModelRegistry& instance();
+
+    // Returns false if the name is already taken
+    bool register_model(std::string const& name, FXModelFactory factory);
+
+    [[nodiscard]] std::expected<std::unique_ptr<ITradingModel>, FXException> create(
+        std::string const& name, FXModelParameters const& parameters = {}) const;
+
+    [[nodiscard]] bool contains(std::string const& name) const;
+
+    [[nodiscard]] std::vector<std::string> model_names() const;
+
+  private:
+    std::unordered_map<std::string, FXModelFactory> factories;
+
+    FXTradingModelRegistry() = default;
+};
+
+// Static Registration | Declare at Namespace Scope in the Model's Source File
+template <typename Model>
+struct FXRegisterTradingModel
+{
+    explicit FXRegisterTradingModel(std::string const& name)
+    {
+        FXTradingModelRegistry::instance().register_model(
+            name, [](FXModelParameters const& parameters) -> std::unique_ptr<ITradingModel> { return std::make_unique<Model>(parameters); });
+    }
+};
+
+}// namespace fxordermgmt
+
+#endif
@@ -4,6 +4,7 @@
 #ifndef FX_UTILITIES_H
 #define FX_UTILITIES_H
 
+#include <array>   // for array
 #include <expected>// for expected
 #include <string>  // for basic_string
 
@@ -16,6 +17,9 @@ class FXUtilities
 {
 
   public:
+    static constexpr std::array<int, 7> SPAN_M = {1, 2, 3, 5, 10, 15, 30};// Span intervals for minutes
+    static constexpr std::array<int, 4> SPAN_H = {1, 2, 4, 8};            // Span intervals for hours
+
     bool fx_utilities_testing = false;
 
     FXUtilities() = default;
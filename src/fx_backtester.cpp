@@ -0,0 +1,364 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_backtester.h"
+
+#include <math.h>  // for round
+#include <stdlib.h>// for abs
+#include <time.h>  // for ctime, time, time_t
+
+#include <algorithm>      // for max, min
+#include <charconv>       // for from_chars
+#include <cstddef>        // for size_t
+#include <cstdint>        // for int64_t, uint32_t, uint64_t
+#include <cstring>        // for memcpy
+#include <expected>       // for expected
+#include <filesystem>     // for create_directories, path
+#include <fstream>        // for basic_ifstream, basic_ofstream
+#include <iterator>       // for istreambuf_iterator
+#include <source_location>// for current, function_name...
+#include <string>         // for string, to_string
+#include <string_view>    // for string_view
+#include <system_error>   // for errc, error_code
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "json/json.hpp"// for json
+
+#include "fx_bar_series.h"             // for FXBarSeries, fx_price_t
+#include "fx_exception.h"              // for FXException
+#include "fx_trade_rules.h"            // for FXTradeRules, FXPosition, FXTradeDecision
+#include "fx_trading_model_interface.h"// for ITradingModel
+#include "fx_trading_model_registry.h" // for FXTradingModelRegistry
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+
+constexpr char BINARY_MAGIC[8] = {'F', 'X', 'B', 'A', 'R', 'S', '0', '1'};
+
+struct BinaryHeader
+{
+    char magic[8];
+    std::uint32_t price_bytes, reserved;
+    std::uint64_t bar_count;
+};
+
+template <typename T>
+bool read_field(std::string_view& line, T& value) noexcept
+{
+    std::size_t const comma = line.find(',');
+    std::string_view field = line.substr(0, comma);
+    while (! field.empty() && (field.front() == ' ' || field.front() == '\t')) { field.remove_prefix(1); }
+    while (! field.empty() && (field.back() == ' ' || field.back() == '\t' || field.back() == '\r')) { field.remove_suffix(1); }
+
+    auto const [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+    line = (comma == std::string_view::npos) ? std::string_view {} : line.substr(comma + 1);
+    return error == std::errc {} && end == field.data() + field.size();
+}
+
+template <typename Stored>
+void read_price_column(std::ifstream& in, std::vector<fx_price_t>& column, std::size_t count)
+{
+    std::vector<Stored> stored(count);
+    in.read(reinterpret_cast<char*>(stored.data()), static_cast<std::streamsize>(count * sizeof(Stored)));
+    column.assign(stored.begin(), stored.end());
+}
+
+// Signed Position is Positive for Buy, Negative for Sell
+int signed_quantity(fxordermgmt::FXPosition const& position) noexcept { return (position.is_buy) ? position.quantity : -position.quantity; }
+
+void apply_fill(fxordermgmt::FXTradeDecision const& decision, double fill_price, fxordermgmt::FXPosition& position, double& entry_price,
+    fxordermgmt::FXBacktestResult& result) noexcept
+{
+    int const held = signed_quantity(position);
+    int const traded = (decision.is_buy) ? decision.quantity : -decision.quantity;
+    int const after = held + traded;
+
+    // Reduces or Reverses the Held Position
+    if (held && (held > 0) != (traded > 0))
+    {
+        int const closed = std::min(abs(traded), abs(held));
+        double const profit = (fill_price - entry_price) * closed * ((held > 0) ? 1 : -1);
+        result.realized_profit += profit;
+        ++result.closed_trades;
+        result.winning_trades += (profit > 0);
+    }
+    if (! after)
+    {
+        entry_price = 0;
+    }
+    else if (! held || (held > 0) != (after > 0))
+    {
+        entry_price = fill_price;
+    }
+    else if (abs(after) > abs(held))
+    {
+        entry_price = (entry_price * abs(held) + fill_price * (abs(after) - abs(held))) / abs(after);
+    }
+
+    position = fxordermgmt::FXPosition {abs(after), after > 0};
+    ++result.order_count;
+    result.traded_volume += decision.quantity;
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+std::expected<FXBarHistory, FXException> FXBacktester::load_csv_bars(std::string const& file_name)
+{
+    std::ifstream in(file_name, std::ios::binary);
+    if (! in.is_open())
+    {
+        return std::expected<FXBarHistory, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Bar File Failed to Open: " + file_name};
+    }
+    std::string const text {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+    FXBarHistory history;
+    std::size_t const estimated_rows = text.size() / 40;
+    history.date_time.reserve(estimated_rows);
+    history.open.reserve(estimated_rows);
+    history.high.reserve(estimated_rows);
+    history.low.reserve(estimated_rows);
+    history.close.reserve(estimated_rows);
+
+    std::size_t line_start = 0, line_number = 0;
+    while (line_start < text.size())
+    {
+        std::size_t line_end = text.find('\n', line_start);
+        line_end = (line_end == std::string::npos) ? text.size() : line_end;
+        std::string_view line {text.data() + line_start, line_end - line_start};
+        line_start = line_end + 1;
+        ++line_number;
+
+        if (line.empty() || line == "\r" || (line_number == 1 && line.front() != '-' && (line.front() < '0' || line.front() > '9')))
+        {
+            continue;
+        }
+
+        std::int64_t date_time = 0;
+        fx_price_t open = 0, high = 0, low = 0, close = 0;
+        if (! read_field(line, date_time) || ! read_field(line, open) || ! read_field(line, high) || ! read_field(line, low) ||
+            ! read_field(line, close))
+        {
+            return std::expected<FXBarHistory, FXException> {std::unexpect, std::source_location::current().function_name(),
+                "Malformed Bar at " + file_name + ":" + std::to_string(line_number)};
+        }
+        if (! history.date_time.empty() && date_time <= history.date_time.back())
+        {
+            return std::expected<FXBarHistory, FXException> {std::unexpect, std::source_location::current().function_name(),
+                "Bars Must Be in Ascending Time Order at " + file_name + ":" + std::to_string(line_number)};
+        }
+        history.date_time.push_back(date_time);
+        history.open.push_back(open);
+        history.high.push_back(high);
+        history.low.push_back(low);
+        history.close.push_back(close);
+    }
+    // -------------------
+    return std::expected<FXBarHistory, FXException> {std::move(history)};
+}
+
+std::expected<FXBarHistory, FXException> FXBacktester::load_binary_bars(std::string const& file_name)
+{
+    std::ifstream in(file_name, std::ios::binary);
+    if (! in.is_open())
+    {
+        return std::expected<FXBarHistory, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Bar File Failed to Open: " + file_name};
+    }
+
+    BinaryHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (! in || std::memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) || (header.price_bytes != 4 && header.price_bytes != 8))
+    {
+        return std::expected<FXBarHistory, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Invalid Binary Bar File: " + file_name};
+    }
+
+    FXBarHistory history;
+    std::size_t const count = header.bar_count;
+    history.date_time.resize(count);
+    in.read(reinterpret_cast<char*>(history.date_time.data()), static_cast<std::streamsize>(count * sizeof(std::int64_t)));
+    for (std::vector<fx_price_t>* column : {&history.open, &history.high, &history.low, &history.close})
+    {
+        if (header.price_bytes == sizeof(fx_price_t))
+        {
+            column->resize(count);
+            in.read(reinterpret_cast<char*>(column->data()), static_cast<std::streamsize>(count * sizeof(fx_price_t)));
+        }
+        else if (header.price_bytes == sizeof(float))
+        {
+            read_price_column<float>(in, *column, count);
+        }
+        else
+        {
+            read_price_column<double>(in, *column, count);
+        }
+    }
+    if (! in)
+    {
+        return std::expected<FXBarHistory, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Binary Bar File Truncated: " + file_name};
+    }
+    // -------------------
+    return std::expected<FXBarHistory, FXException> {std::move(history)};
+}
+
+std::expected<bool, FXException> FXBacktester::write_binary_bars(std::string const& file_name, FXBarHistory const& history)
+{
+    std::ofstream out(file_name, std::ios::binary);
+    if (! out.is_open())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Bar File Failed to Open: " + file_name};
+    }
+
+    BinaryHeader header {{}, sizeof(fx_price_t), 0, history.size()};
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    out.write(reinterpret_cast<char const*>(history.date_time.data()), static_cast<std::streamsize>(history.size() * sizeof(std::int64_t)));
+    for (std::vector<fx_price_t> const* column : {&history.open, &history.high, &history.low, &history.close})
+    {
+        out.write(reinterpret_cast<char const*>(column->data()), static_cast<std::streamsize>(history.size() * sizeof(fx_price_t)));
+    }
+    if (! out.good())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Bar File Failed to Write Data: " + file_name};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<FXBacktestResult, FXException> FXBacktester::run(
+    std::string const& symbol, FXBarHistory const& history, FXBacktestConfig const& config)
+{
+    if (! config.num_data_points || history.size() < config.num_data_points)
+    {
+        return std::expected<FXBacktestResult, FXException> {std::unexpect, std::source_location::current().function_name(),
+            symbol + " History Has " + std::to_string(history.size()) + " Bars; Num_Data_Points Requires " + std::to_string(config.num_data_points)};
+    }
+
+    auto model_response = FXTradingModelRegistry::instance().create(config.model_config.model_name, config.model_config.parameters);
+    if (! model_response)
+    {
+        return std::expected<FXBacktestResult, FXException> {std::unexpect, std::move(model_response.error())};
+    }
+    ITradingModel& trading_model = *model_response.value();
+
+    FXBacktestResult result;
+    result.symbol = symbol;
+    result.bars_processed = history.size();
+    result.first_bar_time = history.date_time.front();
+    result.last_bar_time = history.date_time.back();
+
+    FXBarSeries price_bars {config.num_data_points};
+    FXPosition position;
+    int const base_quantity = FXTradeRules::base_quantity(config.position_multiplier, config.order_position_size);
+    double const fill_offset = config.spread / 2 + config.slippage;
+    double entry_price = 0, peak_equity = 0;
+    // -------------------
+    for (std::size_t x = 0; x < history.size(); ++x)
+    {
+        price_bars.push_back(history.open[x], history.high[x], history.low[x], history.close[x], history.date_time[x]);
+        if (! price_bars.full())
+        {
+            continue;
+        }
+        if (x + 1 == config.num_data_points)
+        {
+            trading_model.on_history_loaded(price_bars);
+        }
+        else
+        {
+            trading_model.on_new_bars(price_bars, 1);
+        }
+
+        double const close = history.close[x];
+        auto const decision = FXTradeRules::decide(trading_model.send_trading_signal(price_bars), position, base_quantity);
+        if (decision)
+        {
+            apply_fill(*decision, (decision->is_buy) ? close + fill_offset : close - fill_offset, position, entry_price, result);
+        }
+        ++result.bars_evaluated;
+
+        // Mark to Market at the Close
+        double const equity = result.realized_profit + (close - entry_price) * signed_quantity(position);
+        peak_equity = std::max(peak_equity, equity);
+        result.max_drawdown = std::max(result.max_drawdown, peak_equity - equity);
+    }
+    // -------------------
+    result.final_position = position;
+    result.entry_price = entry_price;
+    result.last_price = history.close.back();
+    result.unrealized_profit = (result.last_price - entry_price) * signed_quantity(position);
+    return std::expected<FXBacktestResult, FXException> {std::move(result)};
+}
+
+nlohmann::json FXBacktester::build_report(std::vector<FXBacktestResult> const& results, FXBacktestConfig const& config)
+{
+    nlohmann::json report = {}, current_positions = {};
+    double total_profit = 0;
+    for (FXBacktestResult const& result : results)
+    {
+        int const direction = (result.final_position.is_buy) ? 1 : -1;
+        double const profit = (result.final_position.quantity) ? round((result.last_price - result.entry_price) * 100'000) / 100'000 * direction : 0;
+        double const profit_percent = (result.entry_price > 0) ? round(profit * 10'000 / result.entry_price) / 100 : 0;
+        double const symbol_profit = result.realized_profit + result.unrealized_profit;
+        double const win_rate = (result.closed_trades) ? static_cast<double>(result.winning_trades) / static_cast<double>(result.closed_trades) : 0.0;
+        total_profit += symbol_profit;
+
+        current_positions[result.symbol] = {{"Direction", FXTradeRules::direction_name(result.final_position.is_buy)},
+            {"Quantity", result.final_position.quantity}, {"Entry Price", result.entry_price}, {"Current Price", result.last_price},
+            {"Profit", profit}, {"Profit Percent", profit_percent}, {"Realized Profit", round(result.realized_profit * 100) / 100},
+            {"Symbol Profit", round(symbol_profit * 100) / 100}, {"Max Drawdown", round(result.max_drawdown * 100) / 100},
+            {"Orders", result.order_count}, {"Closed Trades", result.closed_trades},
+            {"Win Rate", round(10'000.0 * win_rate) / 100},
+            {"Traded Volume", result.traded_volume}, {"Bars Processed", result.bars_processed}, {"Bars Evaluated", result.bars_evaluated},
+            {"First Bar", result.first_bar_time}, {"Last Bar", result.last_bar_time}};
+    }
+    // -------------------
+    double const current_funds = config.initial_funds + total_profit;
+    report["Backtest Information"] = {{"Model", config.model_config.model_name}, {"Parameters", config.model_config.parameters},
+        {"Num_Data_Points", config.num_data_points}, {"Order_Position_Size", config.order_position_size},
+        {"Position_Multiplier", config.position_multiplier}, {"Spread", config.spread}, {"Slippage", config.slippage}};
+    report["Performance Information"] = {{"Initial Funds", config.initial_funds}, {"Current Funds", round(current_funds * 100) / 100},
+        {"Profit Cumulative", round(total_profit * 100) / 100},
+        {"Profit Percent Cumulative", (config.initial_funds > 0) ? round(total_profit * 10'000 / config.initial_funds) / 100 : 0.0}};
+    report["Position Information"] = current_positions;
+    time_t time_now = time(NULL);
+    report["Last Updated"] = ctime(&time_now);
+    return report;
+}
+
+std::expected<bool, FXException> FXBacktester::write_report(std::string const& file_name, nlohmann::json const& report)
+{
+    std::error_code error;
+    std::filesystem::path const parent = std::filesystem::path(file_name).parent_path();
+    if (! parent.empty())
+    {
+        std::filesystem::create_directories(parent, error);
+    }
+
+    std::ofstream out(file_name);
+    if (! out.is_open())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Backtest Report File Failed to Open: " + file_name};
+    }
+    out << report.dump(4);
+    if (! out.good())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Backtest Report File Failed to Write Data"};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+}// namespace fxordermgmt
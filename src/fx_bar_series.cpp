@@ -0,0 +1,125 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_bar_series.h"
+
+#include <algorithm>// for min, fill_n, equal
+#include <cstddef>  // for size_t, byte
+#include <cstdint>  // for int64_t
+#include <iterator> // for begin, end
+#include <new>      // for align_val_t, operator new[]
+#include <span>     // for span
+
+namespace
+{
+// Cache Line Alignment for Every Column
+constexpr std::size_t COLUMN_ALIGNMENT = 64;
+constexpr std::size_t PRICES_PER_LINE = COLUMN_ALIGNMENT / sizeof(fxordermgmt::fx_price_t);
+}// namespace
+
+namespace fxordermgmt
+{
+
+FXBarSeries::FXBarSeries(std::size_t capacity)
+    : bar_capacity(capacity), column_stride((2 * capacity + PRICES_PER_LINE - 1) / PRICES_PER_LINE * PRICES_PER_LINE)
+{
+    std::size_t const total_bytes = column_stride * (PRICE_COLUMN_COUNT * sizeof(fx_price_t) + sizeof(std::int64_t));
+    if (total_bytes)
+    {
+        data.reset(static_cast<std::byte*>(::operator new[](total_bytes, std::align_val_t {COLUMN_ALIGNMENT})));
+        std::fill_n(data.get(), total_bytes, std::byte {0});
+    }
+}
+
+void FXBarSeries::AlignedDelete::operator()(std::byte* ptr) const noexcept { ::operator delete[](ptr, std::align_val_t {COLUMN_ALIGNMENT}); }
+
+void FXBarSeries::push_back(fx_price_t open, fx_price_t high, fx_price_t low, fx_price_t close, std::int64_t date_time) noexcept
+{
+    if (! bar_capacity)
+    {
+        return;
+    }
+    fx_price_t const prices[PRICE_COLUMN_COUNT] = {open, high, low, close};
+    for (std::size_t col = 0; col < PRICE_COLUMN_COUNT; ++col)
+    {
+        fx_price_t* const column_data = price_column(static_cast<Column>(col));
+        column_data[write_index] = prices[col];
+        column_data[write_index + bar_capacity] = prices[col];
+    }
+    date_time_column()[write_index] = date_time;
+    date_time_column()[write_index + bar_capacity] = date_time;
+
+    write_index = (write_index + 1 == bar_capacity) ? 0 : write_index + 1;
+    bar_count = std::min(bar_count + 1, bar_capacity);
+}
+
+bool FXBarSeries::replace_back(fx_price_t open, fx_price_t high, fx_price_t low, fx_price_t close) noexcept
+{
+    if (! bar_count)
+    {
+        return false;
+    }
+    std::size_t const newest_index = (write_index) ? write_index - 1 : bar_capacity - 1;
+    fx_price_t const prices[PRICE_COLUMN_COUNT] = {open, high, low, close};
+    fx_price_t stored_prices[PRICE_COLUMN_COUNT];
+    for (std::size_t col = 0; col < PRICE_COLUMN_COUNT; ++col)
+    {
+        fx_price_t* const column_data = price_column(static_cast<Column>(col));
+        stored_prices[col] = column_data[newest_index];
+        column_data[newest_index] = prices[col];
+        column_data[newest_index + bar_capacity] = prices[col];
+    }
+    // -------------------
+    return ! std::equal(std::begin(prices), std::end(prices), std::begin(stored_prices));
+}
+
+void FXBarSeries::clear() noexcept { write_index = bar_count = 0; }
+
+std::size_t FXBarSeries::size() const noexcept { return bar_count; }
+
+std::size_t FXBarSeries::capacity() const noexcept { return bar_capacity; }
+
+bool FXBarSeries::full() const noexcept { return bar_capacity && bar_count == bar_capacity; }
+
+std::span<fx_price_t const> FXBarSeries::open() const noexcept
+{
+    return (bar_count) ? std::span<fx_price_t const> {price_column(OPEN) + view_start(), bar_count} : std::span<fx_price_t const> {};
+}
+
+std::span<fx_price_t const> FXBarSeries::high() const noexcept
+{
+    return (bar_count) ? std::span<fx_price_t const> {price_column(HIGH) + view_start(), bar_count} : std::span<fx_price_t const> {};
+}
+
+std::span<fx_price_t const> FXBarSeries::low() const noexcept
+{
+    return (bar_count) ? std::span<fx_price_t const> {price_column(LOW) + view_start(), bar_count} : std::span<fx_price_t const> {};
+}
+
+std::span<fx_price_t const> FXBarSeries::close() const noexcept
+{
+    return (bar_count) ? std::span<fx_price_t const> {price_column(CLOSE) + view_start(), bar_count} : std::span<fx_price_t const> {};
+}
+
+std::span<std::int64_t const> FXBarSeries::date_time() const noexcept
+{
+    return (bar_count) ? std::span<std::int64_t const> {date_time_column() + view_start(), bar_count} : std::span<std::int64_t const> {};
+}
+
+fx_price_t* FXBarSeries::price_column(Column col) const noexcept
+{
+    return reinterpret_cast<fx_price_t*>(data.get()) + col * column_stride;
+}
+
+std::int64_t* FXBarSeries::date_time_column() const noexcept
+{
+    return reinterpret_cast<std::int64_t*>(data.get() + PRICE_COLUMN_COUNT * column_stride * sizeof(fx_price_t));
+}
+
+std::size_t FXBarSeries::view_start() const noexcept
+{
+    // Oldest Bar Sits (bar_count) Slots Behind the Mirrored Write Position
+    return write_index + bar_capacity - bar_count;
+}
+
+}// namespace fxordermgmt
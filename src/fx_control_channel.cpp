@@ -0,0 +1,205 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_control_channel.h"
+
+#include <algorithm>      // for equal, min, find_if_not
+#include <cctype>         // for toupper
+#include <cerrno>         // for errno, EINTR
+#include <cstddef>        // for size_t
+#include <cstring>        // for strerror
+#include <expected>       // for expected
+#include <functional>     // for function
+#include <optional>       // for optional, nullopt
+#include <poll.h>         // for poll, pollfd, POLLIN
+#include <source_location>// for current, function_name...
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <sys/socket.h>   // for socket, bind, listen, accept4, send, connect
+#include <sys/stat.h>     // for chmod, lstat, S_ISSOCK
+#include <sys/un.h>       // for sockaddr_un
+#include <unistd.h>       // for read, close, unlink
+#include <utility>        // for exchange, move
+#include <vector>         // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace
+{
+// A Client that Connects but Never Sends Cannot Hold Up the Trading Thread for Longer
+constexpr int CLIENT_READ_TIMEOUT_MS = 100;
+constexpr std::size_t MAX_COMMAND_LENGTH = 4096;
+
+bool iequals(std::string_view a, std::string_view b) noexcept
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+        [](char x, char y) { return std::toupper(static_cast<unsigned char>(x)) == std::toupper(static_cast<unsigned char>(y)); });
+}
+}// namespace
+
+namespace fxordermgmt
+{
+
+FXControlChannel::~FXControlChannel() { close_channel(); }
+
+FXControlChannel::FXControlChannel(FXControlChannel&& obj) noexcept
+    : listen_fd(std::exchange(obj.listen_fd, -1)), socket_path(std::move(obj.socket_path))
+{
+}
+
+FXControlChannel& FXControlChannel::operator=(FXControlChannel&& obj) noexcept
+{
+    if (this != &obj)
+    {
+        close_channel();
+        listen_fd = std::exchange(obj.listen_fd, -1);
+        socket_path = std::move(obj.socket_path);
+    }
+    return *this;
+}
+
+std::expected<bool, FXException> FXControlChannel::listen(std::string const& path)
+{
+    close_channel();
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Control Socket Path Too Long: " + path};
+    }
+    path.copy(address.sun_path, path.size());
+
+    listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0)
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Control Socket Failed: " + std::string(std::strerror(errno))};
+    }
+    // A Listener That Accepts Belongs to Another Instance; Only a Stale Socket is Removed
+    int const probe_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    bool const in_use = probe_fd >= 0 && connect(probe_fd, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) == 0;
+    if (probe_fd >= 0)
+    {
+        close(probe_fd);
+    }
+    if (in_use)
+    {
+        close(listen_fd);
+        listen_fd = -1;
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Control Socket Already in Use: " + path};
+    }
+    struct stat path_stat {};
+    if (lstat(path.c_str(), &path_stat) == 0 && S_ISSOCK(path_stat.st_mode))
+    {
+        unlink(path.c_str());
+    }
+    if (bind(listen_fd, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) < 0 || chmod(path.c_str(), S_IRUSR | S_IWUSR) < 0 ||
+        ::listen(listen_fd, 8) < 0)
+    {
+        std::string const error = std::strerror(errno);
+        close(listen_fd);
+        listen_fd = -1;
+        unlink(path.c_str());
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Control Socket Failed to Listen on " + path + ": " + error};
+    }
+    socket_path = path;
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+bool FXControlChannel::is_listening() const noexcept { return listen_fd >= 0; }
+
+std::vector<FXControlCommand> FXControlChannel::receive(std::function<bool(std::string_view)> const& is_managed_symbol)
+{
+    std::vector<FXControlCommand> commands;
+    while (listen_fd >= 0)
+    {
+        int const client_fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client_fd < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+
+        std::string request;
+        char buffer[256];
+        pollfd poll_fd {client_fd, POLLIN, 0};
+        while (request.find('\n') == std::string::npos && request.size() < MAX_COMMAND_LENGTH && poll(&poll_fd, 1, CLIENT_READ_TIMEOUT_MS) > 0)
+        {
+            ssize_t const length = read(client_fd, buffer, sizeof(buffer));
+            if (length <= 0)
+            {
+                break;
+            }
+            request.append(buffer, static_cast<std::size_t>(length));
+        }
+
+        auto command = parse_command(std::string_view(request).substr(0, request.find('\n')));
+        std::string reply = (command) ? "OK\n" : "ERROR Expected 'CLOSE ALL' or 'CLOSE <SYMBOL> ...'\n";
+        if (command)
+        {
+            auto const unmanaged = std::find_if_not(command->symbols.begin(), command->symbols.end(), is_managed_symbol);
+            if (unmanaged != command->symbols.end())
+            {
+                reply = "ERROR Symbol Not Managed: " + *unmanaged + "\n";
+                command.reset();
+            }
+        }
+        [[maybe_unused]] ssize_t const sent = send(client_fd, reply.data(), reply.size(), MSG_NOSIGNAL);
+        close(client_fd);
+        if (command)
+        {
+            commands.push_back(std::move(*command));
+        }
+    }
+    return commands;
+}
+
+int FXControlChannel::native_handle() const noexcept { return listen_fd; }
+
+std::optional<FXControlCommand> FXControlChannel::parse_command(std::string_view line)
+{
+    std::vector<std::string_view> tokens;
+    for (std::size_t pos = 0; pos < line.size();)
+    {
+        std::size_t const start = line.find_first_not_of(" \t\r", pos);
+        if (start == std::string_view::npos)
+        {
+            break;
+        }
+        std::size_t const end = std::min(line.find_first_of(" \t\r", start), line.size());
+        tokens.push_back(line.substr(start, end - start));
+        pos = end;
+    }
+    if (tokens.size() < 2 || ! iequals(tokens[0], "CLOSE"))
+    {
+        return std::nullopt;
+    }
+    // -------------------
+    FXControlCommand command;
+    if (tokens.size() == 2 && iequals(tokens[1], "ALL"))
+    {
+        command.close_all = true;
+        return command;
+    }
+    for (std::size_t x = 1; x < tokens.size(); ++x) { command.symbols.emplace_back(tokens[x]); }
+    return command;
+}
+
+void FXControlChannel::close_channel() noexcept
+{
+    if (listen_fd >= 0)
+    {
+        close(listen_fd);
+        listen_fd = -1;
+        unlink(socket_path.c_str());
+    }
+}
+
+}// namespace fxordermgmt
@@ -0,0 +1,240 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_event_loop.h"
+
+#include <algorithm>      // for find_if, max
+#include <cerrno>         // for errno, EINTR
+#include <chrono>         // for system_clock, nanoseconds, duration_cast
+#include <cstdint>        // for uint64_t
+#include <cstring>        // for strerror
+#include <expected>       // for expected
+#include <functional>     // for function
+#include <signal.h>       // for sigemptyset, sigaddset, pthread_sigmask
+#include <source_location>// for current, function_name...
+#include <string>         // for string
+#include <sys/epoll.h>    // for epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h>  // for eventfd
+#include <sys/signalfd.h> // for signalfd, signalfd_siginfo
+#include <sys/timerfd.h>  // for timerfd_create, timerfd_settime
+#include <thread>         // for sleep_until
+#include <unistd.h>       // for read, write, close
+#include <utility>        // for move, exchange
+
+#include "fx_exception.h"// for FXException
+
+namespace
+{
+bool epoll_add(int epoll_fd, int fd) noexcept
+{
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+}// namespace
+
+namespace fxordermgmt
+{
+
+FXEventLoop::~FXEventLoop() { close_all(); }
+
+FXEventLoop::FXEventLoop(FXEventLoop&& obj) noexcept { *this = std::move(obj); }
+
+FXEventLoop& FXEventLoop::operator=(FXEventLoop&& obj) noexcept
+{
+    if (this != &obj)
+    {
+        close_all();
+        run_epoll_fd = std::exchange(obj.run_epoll_fd, -1);
+        wait_epoll_fd = std::exchange(obj.wait_epoll_fd, -1);
+        timer_fd = std::exchange(obj.timer_fd, -1);
+        signal_fd = std::exchange(obj.signal_fd, -1);
+        wake_fd = std::exchange(obj.wake_fd, -1);
+        previous_mask = obj.previous_mask;
+        signals_blocked = std::exchange(obj.signals_blocked, false);
+        sources = std::move(obj.sources);
+        shutdown.store(obj.shutdown.load());
+        dispatching = false;
+    }
+    return *this;
+}
+
+std::expected<bool, FXException> FXEventLoop::initialize()
+{
+    close_all();
+    sigset_t shutdown_signals;
+    sigemptyset(&shutdown_signals);
+    sigaddset(&shutdown_signals, SIGINT);
+    sigaddset(&shutdown_signals, SIGTERM);
+
+    if (pthread_sigmask(SIG_BLOCK, &shutdown_signals, &previous_mask) != 0)
+    {
+        return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(), "Failed to Block Signals"};
+    }
+    signals_blocked = true;
+    signal_fd = signalfd(-1, &shutdown_signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    timer_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    run_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wait_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+    bool valid = signal_fd >= 0 && timer_fd >= 0 && wake_fd >= 0 && run_epoll_fd >= 0 && wait_epoll_fd >= 0;
+    for (int const epoll_fd : {run_epoll_fd, wait_epoll_fd})
+    {
+        valid = valid && epoll_add(epoll_fd, timer_fd) && epoll_add(epoll_fd, signal_fd) && epoll_add(epoll_fd, wake_fd);
+    }
+    if (! valid)
+    {
+        std::string const error = std::strerror(errno);
+        close_all();
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Event Loop Failed to Initialize: " + error};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+bool FXEventLoop::is_initialized() const noexcept { return run_epoll_fd >= 0; }
+
+std::expected<bool, FXException> FXEventLoop::add_source(int fd, std::function<void()> handler)
+{
+    if (! is_initialized() || fd < 0 || ! epoll_add(run_epoll_fd, fd))
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Failed to Add Event Source: " + std::to_string(fd)};
+    }
+    sources.emplace_back(fd, std::move(handler));
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+bool FXEventLoop::run_once(std::chrono::system_clock::time_point deadline) { return wait(deadline, true); }
+
+bool FXEventLoop::wait_for(std::chrono::milliseconds duration) { return wait(std::chrono::system_clock::now() + duration, false); }
+
+void FXEventLoop::request_shutdown() noexcept
+{
+    shutdown.store(true);
+    if (wake_fd >= 0)
+    {
+        std::uint64_t const increment = 1;
+        [[maybe_unused]] ssize_t const written = write(wake_fd, &increment, sizeof(increment));
+    }
+}
+
+bool FXEventLoop::shutdown_requested() const noexcept { return shutdown.load(); }
+
+bool FXEventLoop::wait(std::chrono::system_clock::time_point deadline, bool dispatch_sources)
+{
+    // The Wake-Up May Already Have Been Consumed by an Earlier Wait
+    if (shutdown.load())
+    {
+        return false;
+    }
+    if (! is_initialized())
+    {
+        std::this_thread::sleep_until(deadline);
+        return true;
+    }
+
+    // Nested Waits from a Handler Leave the Sources to the Outer Loop
+    dispatch_sources = dispatch_sources && ! dispatching;
+    int const epoll_fd = (dispatch_sources) ? run_epoll_fd : wait_epoll_fd;
+    arm_timer(deadline);
+
+    epoll_event events[16];
+    while (true)
+    {
+        int const ready = epoll_wait(epoll_fd, events, 16, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            std::this_thread::sleep_until(deadline);
+            return true;
+        }
+
+        bool deadline_reached = false, woken_by_shutdown = false, dispatched = false;
+        for (int x = 0; x < ready; ++x)
+        {
+            int const fd = events[x].data.fd;
+            if (fd == timer_fd)
+            {
+                std::uint64_t expirations = 0;
+                deadline_reached = read(timer_fd, &expirations, sizeof(expirations)) > 0 || std::chrono::system_clock::now() >= deadline;
+            }
+            else if (fd == signal_fd)
+            {
+                signalfd_siginfo info;
+                while (read(signal_fd, &info, sizeof(info)) > 0) {}
+                shutdown.store(true);
+                woken_by_shutdown = true;
+            }
+            else if (fd == wake_fd)
+            {
+                std::uint64_t wake_count = 0;
+                [[maybe_unused]] ssize_t const length = read(wake_fd, &wake_count, sizeof(wake_count));
+                woken_by_shutdown = shutdown.load();
+            }
+            else
+            {
+                auto const source = std::find_if(sources.begin(), sources.end(), [fd](auto const& entry) { return entry.first == fd; });
+                if (source != sources.end())
+                {
+                    dispatching = true;
+                    source->second();
+                    dispatching = false;
+                    dispatched = true;
+                    // A Nested Wait May Have Re-Armed the Timer
+                    arm_timer(deadline);
+                }
+            }
+        }
+        // -------------------
+        if (woken_by_shutdown)
+        {
+            arm_timer(std::chrono::system_clock::time_point {});
+            return false;
+        }
+        if (deadline_reached || dispatched)
+        {
+            return true;
+        }
+    }
+}
+
+void FXEventLoop::arm_timer(std::chrono::system_clock::time_point deadline) noexcept
+{
+    // An Absolute Time in the Past Fires Immediately | Zero Disarms
+    auto const since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    itimerspec timer_spec {};
+    if (deadline != std::chrono::system_clock::time_point {})
+    {
+        std::int64_t const nanoseconds = std::max<std::int64_t>(since_epoch, 1);
+        timer_spec.it_value.tv_sec = nanoseconds / 1'000'000'000;
+        timer_spec.it_value.tv_nsec = nanoseconds % 1'000'000'000;
+    }
+    timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &timer_spec, nullptr);
+}
+
+void FXEventLoop::close_all() noexcept
+{
+    for (int* fd : {&run_epoll_fd, &wait_epoll_fd, &timer_fd, &signal_fd, &wake_fd})
+    {
+        if (*fd >= 0)
+        {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+    if (signals_blocked)
+    {
+        pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+        signals_blocked = false;
+    }
+}
+
+}// namespace fxordermgmt
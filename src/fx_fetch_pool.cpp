@@ -0,0 +1,106 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_fetch_pool.h"
+
+#include <algorithm>      // for max
+#include <cerrno>         // for errno
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <cstring>        // for strerror
+#include <expected>       // for expected
+#include <functional>     // for function
+#include <mutex>          // for unique_lock, lock_guard
+#include <source_location>// for current, function_name...
+#include <string>         // for string
+#include <sys/eventfd.h>  // for eventfd
+#include <unistd.h>       // for read, write, close
+#include <utility>        // for move, swap
+#include <vector>         // for vector
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+FXFetchPool::~FXFetchPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        queued_requests.clear();
+    }
+    request_ready.notify_all();
+    for (std::thread& worker : workers) { worker.join(); }
+    if (completion_fd >= 0)
+    {
+        close(completion_fd);
+    }
+}
+
+std::expected<bool, FXException> FXFetchPool::start(std::size_t max_concurrency)
+{
+    if (completion_fd >= 0)
+    {
+        return std::expected<bool, FXException> {true};
+    }
+    completion_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (completion_fd < 0)
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Fetch Pool Failed to Start: " + std::string(std::strerror(errno))};
+    }
+
+    std::size_t const thread_count = std::max<std::size_t>(max_concurrency, 1);
+    workers.reserve(thread_count);
+    for (std::size_t x = 0; x < thread_count; ++x) { workers.emplace_back(&FXFetchPool::run, this); }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+void FXFetchPool::submit(std::size_t id, std::function<void()> request)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued_requests.emplace_back(id, std::move(request));
+    }
+    request_ready.notify_one();
+}
+
+std::vector<std::size_t> FXFetchPool::take_completed()
+{
+    std::vector<std::size_t> finished;
+    std::lock_guard<std::mutex> lock(mutex);
+    // Reset the Counter Under the Lock so a Completion Never Goes Unsignalled
+    std::uint64_t completion_count = 0;
+    [[maybe_unused]] ssize_t const length = read(completion_fd, &completion_count, sizeof(completion_count));
+    std::swap(finished, completed_ids);
+    return finished;
+}
+
+int FXFetchPool::native_handle() const noexcept { return completion_fd; }
+
+void FXFetchPool::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        request_ready.wait(lock, [this]() { return stopping || ! queued_requests.empty(); });
+        if (stopping)
+        {
+            return;
+        }
+        auto [id, request] = std::move(queued_requests.front());
+        queued_requests.pop_front();
+        // ------------
+        lock.unlock();
+        request();
+        lock.lock();
+
+        completed_ids.push_back(id);
+        std::uint64_t const increment = 1;
+        [[maybe_unused]] ssize_t const written = write(completion_fd, &increment, sizeof(increment));
+    }
+}
+
+}// namespace fxordermgmt
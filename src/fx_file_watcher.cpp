@@ -0,0 +1,112 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_file_watcher.h"
+
+#include <cerrno>         // for errno, EINTR
+#include <cstddef>        // for size_t
+#include <cstring>        // for strerror
+#include <expected>       // for expected
+#include <filesystem>     // for path
+#include <source_location>// for current, function_name...
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <sys/inotify.h>  // for inotify_init1, inotify_add_watch, inotify_event
+#include <unistd.h>       // for read, close
+#include <utility>        // for exchange, move
+
+#include "fx_exception.h"// for FXException
+
+namespace fxordermgmt
+{
+
+FXFileWatcher::~FXFileWatcher() { close_watch(); }
+
+FXFileWatcher::FXFileWatcher(FXFileWatcher&& obj) noexcept
+    : inotify_fd(std::exchange(obj.inotify_fd, -1)), file_name(std::move(obj.file_name))
+{
+}
+
+FXFileWatcher& FXFileWatcher::operator=(FXFileWatcher&& obj) noexcept
+{
+    if (this != &obj)
+    {
+        close_watch();
+        inotify_fd = std::exchange(obj.inotify_fd, -1);
+        file_name = std::move(obj.file_name);
+    }
+    return *this;
+}
+
+std::expected<bool, FXException> FXFileWatcher::watch(std::string const& file_path)
+{
+    close_watch();
+    std::filesystem::path const path(file_path);
+    std::string const directory = (path.has_parent_path()) ? path.parent_path().string() : ".";
+
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0)
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "inotify Init Failed: " + std::string(std::strerror(errno))};
+    }
+    if (inotify_add_watch(inotify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0)
+    {
+        std::string const error = std::strerror(errno);
+        close_watch();
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Failed to Watch " + directory + ": " + error};
+    }
+    file_name = path.filename().string();
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+bool FXFileWatcher::is_watching() const noexcept { return inotify_fd >= 0; }
+
+bool FXFileWatcher::changed()
+{
+    if (inotify_fd < 0)
+    {
+        return false;
+    }
+
+    bool file_changed = false;
+    alignas(inotify_event) char events[4096];
+    while (true)
+    {
+        ssize_t const length = read(inotify_fd, events, sizeof(events));
+        if (length <= 0)
+        {
+            if (length < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        for (std::size_t offset = 0; offset < static_cast<std::size_t>(length);)
+        {
+            auto const* event = reinterpret_cast<inotify_event const*>(events + offset);
+            // Names are NUL Padded | A Dropped Queue Could Have Held Anything
+            if ((event->mask & IN_Q_OVERFLOW) || (event->len && std::string_view(event->name) == file_name))
+            {
+                file_changed = true;
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+    return file_changed;
+}
+
+int FXFileWatcher::native_handle() const noexcept { return inotify_fd; }
+
+void FXFileWatcher::close_watch() noexcept
+{
+    if (inotify_fd >= 0)
+    {
+        close(inotify_fd);
+        inotify_fd = -1;
+    }
+}
+
+}// namespace fxordermgmt
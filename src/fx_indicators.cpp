@@ -0,0 +1,404 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_indicators.h"
+
+#include <algorithm>       // for max, fill_n, min
+#include <cmath>           // for abs, isnan, sqrt
+#include <cstddef>         // for size_t
+#include <expected>        // for expected
+#include <functional>      // for less
+#include <initializer_list>// for initializer_list
+#include <limits>          // for numeric_limits
+#include <source_location> // for source_location
+#include <span>            // for span
+
+#if __has_include(<experimental/simd>) && ! defined(FX_SCALAR_INDICATORS)
+#include <experimental/simd>// for native_simd, element_aligned
+#define FX_SIMD_INDICATORS
+#endif
+
+#include "fx_bar_series.h"// for fx_price_t
+#include "fx_exception.h" // for FXException
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+
+constexpr fx_price_t NOT_A_NUMBER = std::numeric_limits<fx_price_t>::quiet_NaN();
+
+#ifdef FX_SIMD_INDICATORS
+namespace stdx = std::experimental;
+using simd_t = stdx::native_simd<fx_price_t>;
+#endif
+
+// Kernels are Generic Lambdas Called with Either simd_t or fx_price_t Arguments
+template <typename Kernel, typename... Inputs>
+void vector_transform(std::span<fx_price_t> out, Kernel kernel, Inputs const*... inputs) noexcept
+{
+    std::size_t x = 0;
+#ifdef FX_SIMD_INDICATORS
+    for (; x + simd_t::size() <= out.size(); x += simd_t::size())
+    {
+        kernel(simd_t {inputs + x, stdx::element_aligned}...).copy_to(out.data() + x, stdx::element_aligned);
+    }
+#endif
+    for (; x < out.size(); ++x) { out[x] = kernel(inputs[x]...); }
+}
+
+auto const subtract = [](auto a, auto b) { return a - b; };
+
+bool overlaps(std::span<fx_price_t const> a, std::span<fx_price_t const> b) noexcept
+{
+    std::less<fx_price_t const*> const less;
+    return ! a.empty() && ! b.empty() && less(a.data(), b.data() + b.size()) && less(b.data(), a.data() + a.size());
+}
+
+std::expected<bool, fxordermgmt::FXException> validate(std::size_t period, std::initializer_list<std::span<fx_price_t const>> inputs,
+    std::initializer_list<std::span<fx_price_t>> outputs, std::source_location location = std::source_location::current())
+{
+    auto error = [&](char const* message) { return std::expected<bool, fxordermgmt::FXException> {std::unexpect, location.function_name(), message}; };
+
+    if (! period)
+    {
+        return error("Indicator period must be positive");
+    }
+    std::size_t const size = inputs.begin()->size();
+    for (auto const& input : inputs)
+    {
+        if (input.size() != size)
+        {
+            return error("Indicator inputs must be the same length");
+        }
+    }
+    for (auto output = outputs.begin(); output != outputs.end(); ++output)
+    {
+        if (output->size() != size)
+        {
+            return error("Indicator output must be the same length as the input");
+        }
+        for (auto const& input : inputs)
+        {
+            if (overlaps(*output, input))
+            {
+                return error("Indicator output overlaps an input");
+            }
+        }
+        for (auto other = outputs.begin(); other != output; ++other)
+        {
+            if (overlaps(*output, *other))
+            {
+                return error("Indicator outputs overlap");
+            }
+        }
+    }
+    return std::expected<bool, fxordermgmt::FXException> {true};
+}
+
+void rolling_mean(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out) noexcept
+{
+    std::size_t const size = values.size();
+    std::fill_n(out.begin(), std::min(period - 1, size), NOT_A_NUMBER);
+    if (size < period)
+    {
+        return;
+    }
+    // Window Deltas (values[x] - values[x - period]) are Staged in out[x]
+    vector_transform(out.subspan(period), subtract, values.data() + period, values.data());
+
+    // Serial | Each Window Sum Builds on the Previous One
+    double sum = 0;
+    for (std::size_t x = 0; x < period; ++x) { sum += static_cast<double>(values[x]); }
+    double const inverse_period = 1.0 / static_cast<double>(period);
+    out[period - 1] = static_cast<fx_price_t>(sum * inverse_period);
+    for (std::size_t x = period; x < size; ++x)
+    {
+        sum += static_cast<double>(out[x]);
+        out[x] = static_cast<fx_price_t>(sum * inverse_period);
+    }
+}
+
+void exponential_mean(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out) noexcept
+{
+    std::size_t const size = values.size();
+    std::fill_n(out.begin(), std::min(period - 1, size), NOT_A_NUMBER);
+    if (size < period)
+    {
+        return;
+    }
+
+    double ema = 0;
+    for (std::size_t x = 0; x < period; ++x) { ema += static_cast<double>(values[x]); }
+    ema /= static_cast<double>(period);
+    out[period - 1] = static_cast<fx_price_t>(ema);
+
+    double const alpha = 2.0 / static_cast<double>(period + 1);
+    for (std::size_t x = period; x < size; ++x)
+    {
+        ema += alpha * (static_cast<double>(values[x]) - ema);
+        out[x] = static_cast<fx_price_t>(ema);
+    }
+}
+
+// Calls (func)(index, mean, variance) for Each Complete Window
+template <typename Func>
+void rolling_moments(std::span<fx_price_t const> values, std::size_t period, Func&& func) noexcept
+{
+    if (values.size() < period)
+    {
+        return;
+    }
+    // Shifted by the First Value to Limit Cancellation in (sum_sq - sum^2)
+    double const shift = values[0], inverse_period = 1.0 / static_cast<double>(period);
+    double sum = 0, sum_sq = 0;
+    for (std::size_t x = 0; x < values.size(); ++x)
+    {
+        double const value = static_cast<double>(values[x]) - shift;
+        sum += value;
+        sum_sq += value * value;
+        if (x >= period)
+        {
+            double const expired = static_cast<double>(values[x - period]) - shift;
+            sum -= expired;
+            sum_sq -= expired * expired;
+        }
+        if (x + 1 >= period)
+        {
+            double const mean = sum * inverse_period;
+            func(x, mean + shift, std::max(sum_sq * inverse_period - mean * mean, 0.0));
+        }
+    }
+}
+
+// Averages are Never Negative, so (<= 0) Tests for Zero
+double relative_strength_index(double average_gain, double average_loss) noexcept
+{
+    if (average_loss <= 0)
+    {
+        return (average_gain <= 0) ? 50.0 : 100.0;
+    }
+    return 100.0 - 100.0 / (1.0 + average_gain / average_loss);
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+std::expected<bool, FXException> FXIndicators::sma(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {values}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    rolling_mean(values, period, out);
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::ema(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {values}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    exponential_mean(values, period, out);
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::rolling_stdev(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {values}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    std::fill_n(out.begin(), std::min(period - 1, values.size()), NOT_A_NUMBER);
+    rolling_moments(values, period, [&](std::size_t x, double, double variance) { out[x] = static_cast<fx_price_t>(variance); });
+    if (values.size() >= period)
+    {
+        std::span<fx_price_t> const complete = out.subspan(period - 1);
+        vector_transform(
+            complete,
+            [](auto variance) {
+                using std::sqrt;
+                return sqrt(variance);
+            },
+            complete.data());
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::zscore(std::span<fx_price_t const> values, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {values}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    std::fill_n(out.begin(), std::min(period - 1, values.size()), NOT_A_NUMBER);
+    rolling_moments(values, period, [&](std::size_t x, double mean, double variance) {
+        out[x] = (variance > 0) ? static_cast<fx_price_t>((static_cast<double>(values[x]) - mean) / std::sqrt(variance)) : fx_price_t {0};
+    });
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::rsi(std::span<fx_price_t const> close, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {close}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    std::size_t const size = close.size();
+    if (size <= period)
+    {
+        std::fill(out.begin(), out.end(), NOT_A_NUMBER);
+        return std::expected<bool, FXException> {true};
+    }
+    // Bar to Bar Changes are Staged in out[1..]
+    vector_transform(out.subspan(1), subtract, close.data() + 1, close.data());
+
+    // Serial | Wilder Smoothing Carries the Previous Averages Forward
+    double average_gain = 0, average_loss = 0;
+    for (std::size_t x = 1; x <= period; ++x)
+    {
+        average_gain += std::max<double>(out[x], 0);
+        average_loss += std::max<double>(-out[x], 0);
+    }
+    double const window = static_cast<double>(period);
+    average_gain /= window;
+    average_loss /= window;
+    std::fill_n(out.begin(), period, NOT_A_NUMBER);
+    out[period] = static_cast<fx_price_t>(relative_strength_index(average_gain, average_loss));
+
+    for (std::size_t x = period + 1; x < size; ++x)
+    {
+        average_gain = (average_gain * (window - 1) + std::max<double>(out[x], 0)) / window;
+        average_loss = (average_loss * (window - 1) + std::max<double>(-out[x], 0)) / window;
+        out[x] = static_cast<fx_price_t>(relative_strength_index(average_gain, average_loss));
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::atr(std::span<fx_price_t const> high, std::span<fx_price_t const> low,
+    std::span<fx_price_t const> close, std::size_t period, std::span<fx_price_t> out)
+{
+    auto response = validate(period, {high, low, close}, {out});
+    if (! response)
+    {
+        return response;
+    }
+    std::size_t const size = high.size();
+    if (size < period)
+    {
+        std::fill(out.begin(), out.end(), NOT_A_NUMBER);
+        return std::expected<bool, FXException> {true};
+    }
+    // True Range is Staged in out; the First Bar has No Previous Close
+    out[0] = high[0] - low[0];
+    vector_transform(
+        out.subspan(1),
+        [](auto bar_high, auto bar_low, auto previous_close) {
+            using std::abs;
+            using std::max;
+            return max(bar_high - bar_low, max(abs(bar_high - previous_close), abs(bar_low - previous_close)));
+        },
+        high.data() + 1, low.data() + 1, close.data());
+
+    double average_range = 0;
+    for (std::size_t x = 0; x < period; ++x) { average_range += static_cast<double>(out[x]); }
+    double const window = static_cast<double>(period);
+    average_range /= window;
+    std::fill_n(out.begin(), period - 1, NOT_A_NUMBER);
+    out[period - 1] = static_cast<fx_price_t>(average_range);
+
+    for (std::size_t x = period; x < size; ++x)
+    {
+        average_range = (average_range * (window - 1) + static_cast<double>(out[x])) / window;
+        out[x] = static_cast<fx_price_t>(average_range);
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::bollinger(std::span<fx_price_t const> values, std::size_t period, fx_price_t num_stdev,
+    std::span<fx_price_t> upper, std::span<fx_price_t> middle, std::span<fx_price_t> lower)
+{
+    auto response = validate(period, {values}, {upper, middle, lower});
+    if (! response)
+    {
+        return response;
+    }
+    std::size_t const incomplete = std::min(period - 1, values.size());
+    std::fill_n(upper.begin(), incomplete, NOT_A_NUMBER);
+    std::fill_n(middle.begin(), incomplete, NOT_A_NUMBER);
+    std::fill_n(lower.begin(), incomplete, NOT_A_NUMBER);
+
+    // Standard Deviation is Staged in (upper)
+    rolling_moments(values, period, [&](std::size_t x, double mean, double variance) {
+        middle[x] = static_cast<fx_price_t>(mean);
+        upper[x] = static_cast<fx_price_t>(std::sqrt(variance));
+    });
+    if (values.size() >= period)
+    {
+        std::size_t const start = period - 1;
+        vector_transform(
+            lower.subspan(start), [num_stdev](auto mean, auto stdev) { return mean - num_stdev * stdev; }, middle.data() + start,
+            upper.data() + start);
+        vector_transform(
+            upper.subspan(start), [num_stdev](auto mean, auto stdev) { return mean + num_stdev * stdev; }, middle.data() + start,
+            upper.data() + start);
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXIndicators::macd(std::span<fx_price_t const> values, std::size_t fast_period, std::size_t slow_period,
+    std::size_t signal_period, std::span<fx_price_t> macd_line, std::span<fx_price_t> signal_line, std::span<fx_price_t> histogram)
+{
+    auto response = validate(std::min({fast_period, slow_period, signal_period}), {values}, {macd_line, signal_line, histogram});
+    if (! response)
+    {
+        return response;
+    }
+    std::size_t const size = values.size(), start = std::max(fast_period, slow_period) - 1;
+    if (size <= start)
+    {
+        std::fill(macd_line.begin(), macd_line.end(), NOT_A_NUMBER);
+        std::fill(signal_line.begin(), signal_line.end(), NOT_A_NUMBER);
+        std::fill(histogram.begin(), histogram.end(), NOT_A_NUMBER);
+        return std::expected<bool, FXException> {true};
+    }
+    // Slow EMA is Staged in (histogram)
+    exponential_mean(values, fast_period, macd_line);
+    exponential_mean(values, slow_period, histogram);
+    std::span<fx_price_t> const macd_complete = macd_line.subspan(start);
+    vector_transform(macd_complete, subtract, macd_complete.data(), histogram.data() + start);
+    std::fill_n(macd_line.begin(), start, NOT_A_NUMBER);
+
+    std::fill_n(signal_line.begin(), start, NOT_A_NUMBER);
+    exponential_mean(macd_complete, signal_period, signal_line.subspan(start));
+    vector_transform(histogram, subtract, macd_line.data(), signal_line.data());
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+bool FXIndicators::values_match(fx_price_t streaming_value, fx_price_t batch_value) noexcept
+{
+    if (std::isnan(streaming_value) || std::isnan(batch_value))
+    {
+        return std::isnan(streaming_value) && std::isnan(batch_value);
+    }
+    double const tolerance = 1e-5 * std::max(1.0, std::abs(static_cast<double>(batch_value)));
+    return std::abs(static_cast<double>(streaming_value) - static_cast<double>(batch_value)) <= tolerance;
+}
+
+}// namespace fxordermgmt
@@ -18,7 +18,8 @@
 #include <string>         // for allocator, basic_string, char_traits, opera...
 #include <string_view>    // for basic_string_view
 
-#include "fx_exception.h"// for FXException
+#include "fx_event_loop.h"// for FXEventLoop
+#include "fx_exception.h" // for FXException
 
 namespace
 {
@@ -72,9 +73,13 @@ std::expected<bool, FXException> FXMarketTime::wait_till_forex_market_is_open()
 
     set_trading_time_bounds();
     // -------------------
-    return std::expected<bool, FXException> {true};
+    return std::expected<bool, FXException> {! shutdown_requested()};
 }
 
+void FXMarketTime::set_event_loop(FXEventLoop* loop) noexcept { event_loop = loop; }
+
+bool FXMarketTime::shutdown_requested() const noexcept { return event_loop && event_loop->shutdown_requested(); }
+
 void FXMarketTime::set_timezone_offset()
 {
     ch::zoned_time const local_time = ch::zoned_time {ch::current_zone(), ch::system_clock::now()};
@@ -142,7 +147,7 @@ void FXMarketTime::wait_till_active_trading_day(int& start_days_adjustment, int&
 
     bool market_is_open = is_market_open_today(get_todays_date(), start_days_adjustment, end_days_adjustment, get_day_of_week());
     // -------------------
-    while (! market_is_open)
+    while (! market_is_open && ! shutdown_requested())
     {
         int time_to_wait = seconds_till_market_open_tomorrow(seconds_till_open, start_days_adjustment, end_days_adjustment);
         pause_for_set_time(time_to_wait);
@@ -191,6 +196,11 @@ void FXMarketTime::set_trading_time_bounds() noexcept
 void FXMarketTime::pause_for_set_time(std::size_t seconds_to_wait) const noexcept
 {
     std::cout << "Market Closed; Will check if market is open in " << round(seconds_to_wait / 36) / 100 << " Hours...\n";
+    if (event_loop)
+    {
+        event_loop->wait_for(ch::seconds(static_cast<ch::seconds::rep>(seconds_to_wait)));
+        return;
+    }
     sleep(seconds_to_wait);
 }
 
@@ -0,0 +1,215 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_order_book.h"
+
+#include <algorithm>    // for find, clamp
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <optional>     // for optional, nullopt
+#include <string>       // for string
+#include <unordered_map>// for erase_if
+#include <vector>       // for vector
+
+#include "json/json.hpp"// for json
+
+#include "fx_order_intent.h"// for FXOrderSide, FXOrderSubmission
+
+namespace fxordermgmt
+{
+
+bool FXOrderBook::submit(FXOrderSubmission const& submission)
+{
+    if (! submission.accepted || orders.contains(submission.order_id))
+    {
+        return false;
+    }
+    FXTrackedOrder& order = orders[submission.order_id];
+    order = FXTrackedOrder {submission.order_id, submission.intent, FXOrderState::PENDING, 0};
+    // ------------
+    if (submission.intent.symbol_id >= symbol_exposure.size())
+    {
+        symbol_exposure.resize(submission.intent.symbol_id + 1, 0);
+    }
+    symbol_exposure[order.intent.symbol_id] += signed_remaining(order);
+    ++live_orders;
+
+    auto const state = state_from_status(submission.status_id);
+    if (submission.filled_quantity > 0)
+    {
+        apply_fill(order.order_id, submission.filled_quantity);
+    }
+    else if (state && *state != FXOrderState::PENDING)
+    {
+        transition(order.order_id, *state);
+    }
+    return true;
+}
+
+void FXOrderBook::read_trade_response(nlohmann::json const& response, FXOrderSubmission& submission)
+{
+    if (response.contains("OrderId") && response["OrderId"].is_number_integer())
+    {
+        submission.order_id = response["OrderId"];
+    }
+    if (response.contains("Orders") && response["Orders"].is_array())
+    {
+        for (auto const& order : response["Orders"])
+        {
+            if (! order.is_object() || ! order.contains("OrderId") || order["OrderId"] != submission.order_id)
+            {
+                continue;
+            }
+            char const* const status_key = (order.contains("StatusId")) ? "StatusId" : "Status";
+            if (order.contains(status_key) && order[status_key].is_number_integer())
+            {
+                submission.status_id = order[status_key];
+            }
+            if (state_from_status(submission.status_id) == FXOrderState::FILLED)
+            {
+                bool const has_quantity = order.contains("Quantity") && order["Quantity"].is_number();
+                int const quantity = (has_quantity) ? order["Quantity"].get<int>() : submission.intent.quantity;
+                submission.filled_quantity = std::clamp(quantity, 0, submission.intent.quantity);
+            }
+        }
+    }
+    // Cancelled (4) or Rejected (5) on Submission
+    submission.accepted = submission.order_id > 0 && submission.status_id != 4 && submission.status_id != 5;
+    if (! submission.accepted)
+    {
+        submission.error_message = "Order Not Accepted: " + response.dump();
+    }
+}
+
+std::optional<FXOrderState> FXOrderBook::state_from_status(int status_id) noexcept
+{
+    switch (status_id)
+    {
+    case 1: return FXOrderState::PENDING;
+    case 2:
+    case 11: return FXOrderState::WORKING;
+    case 3:
+    case 9: return FXOrderState::FILLED;
+    case 4: return FXOrderState::CANCELLED;
+    case 5: return FXOrderState::REJECTED;
+    default: return std::nullopt;
+    }
+}
+
+bool FXOrderBook::is_terminal(FXOrderState state) noexcept
+{
+    return state == FXOrderState::FILLED || state == FXOrderState::CANCELLED || state == FXOrderState::REJECTED ||
+           state == FXOrderState::UNKNOWN;
+}
+
+bool FXOrderBook::apply_status(std::int64_t order_id, int status_id)
+{
+    auto const state = state_from_status(status_id);
+    return state && transition(order_id, *state);
+}
+
+bool FXOrderBook::apply_fill(std::int64_t order_id, int filled_quantity)
+{
+    auto it = orders.find(order_id);
+    if (it == orders.end() || is_terminal(it->second.state) || filled_quantity < it->second.filled_quantity)
+    {
+        return false;
+    }
+    FXTrackedOrder& order = it->second;
+    int const quantity = std::clamp(filled_quantity, 0, order.intent.quantity);
+    if (quantity == order.filled_quantity)
+    {
+        return true;
+    }
+    update(order, (quantity == order.intent.quantity) ? FXOrderState::FILLED : FXOrderState::PARTIALLY_FILLED, quantity);
+    return true;
+}
+
+bool FXOrderBook::transition(std::int64_t order_id, FXOrderState state)
+{
+    auto it = orders.find(order_id);
+    if (it == orders.end())
+    {
+        return false;
+    }
+    FXTrackedOrder& order = it->second;
+    bool const backwards = (state == FXOrderState::PENDING && order.state != FXOrderState::PENDING) ||
+                           (state == FXOrderState::WORKING && order.state == FXOrderState::PARTIALLY_FILLED);
+    if (is_terminal(order.state) || backwards)
+    {
+        return false;
+    }
+    update(order, state, (state == FXOrderState::FILLED) ? order.intent.quantity : order.filled_quantity);
+    return true;
+}
+
+std::vector<std::int64_t> FXOrderBook::mark_unlisted_orders(std::vector<std::int64_t> const& listed_order_ids)
+{
+    std::vector<std::int64_t> unlisted_order_ids;
+    for (auto& [order_id, order] : orders)
+    {
+        if (! is_terminal(order.state) && std::find(listed_order_ids.begin(), listed_order_ids.end(), order_id) == listed_order_ids.end())
+        {
+            update(order, FXOrderState::UNKNOWN, order.filled_quantity);
+            unlisted_order_ids.push_back(order_id);
+        }
+    }
+    return unlisted_order_ids;
+}
+
+FXTrackedOrder const* FXOrderBook::find(std::int64_t order_id) const
+{
+    auto const it = orders.find(order_id);
+    return (it != orders.end()) ? &it->second : nullptr;
+}
+
+int FXOrderBook::outstanding_exposure(fx_symbol_id_t symbol_id) const noexcept
+{
+    return (symbol_id < symbol_exposure.size()) ? symbol_exposure[symbol_id] : 0;
+}
+
+std::size_t FXOrderBook::working_orders() const noexcept { return live_orders; }
+
+std::vector<std::int64_t> FXOrderBook::live_order_ids() const
+{
+    std::vector<std::int64_t> order_ids;
+    for (auto const& [order_id, order] : orders)
+    {
+        if (! is_terminal(order.state))
+        {
+            order_ids.push_back(order_id);
+        }
+    }
+    return order_ids;
+}
+
+void FXOrderBook::clear_terminal_orders()
+{
+    std::erase_if(orders, [](auto const& entry) { return is_terminal(entry.second.state); });
+}
+
+int FXOrderBook::signed_remaining(FXTrackedOrder const& order) noexcept
+{
+    if (is_terminal(order.state))
+    {
+        return 0;
+    }
+    int const remaining = order.intent.quantity - order.filled_quantity;
+    return (order.intent.side == FXOrderSide::BUY) ? remaining : -remaining;
+}
+
+void FXOrderBook::update(FXTrackedOrder& order, FXOrderState state, int filled_quantity)
+{
+    int const previous_exposure = signed_remaining(order);
+    bool const was_live = ! is_terminal(order.state);
+
+    order.state = state;
+    order.filled_quantity = filled_quantity;
+    symbol_exposure[order.intent.symbol_id] += signed_remaining(order) - previous_exposure;
+    if (was_live && is_terminal(state))
+    {
+        --live_orders;
+    }
+}
+
+}// namespace fxordermgmt
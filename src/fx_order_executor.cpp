@@ -0,0 +1,284 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_order_executor.h"
+
+#include <algorithm>      // for find_if, max, min
+#include <charconv>       // for from_chars
+#include <chrono>         // for steady_clock, milliseconds, microseconds
+#include <cstddef>        // for size_t
+#include <cstdint>        // for int64_t
+#include <expected>       // for expected
+#include <source_location>// for current, function_name...
+#include <string>         // for string, to_string
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "boost/log/trivial.hpp"// for BOOST_LOG_TRIVIAL
+#include "json/json.hpp"        // for json
+
+#include "fx_exception.h"    // for FXException
+#include "fx_order_book.h"   // for FXOrderBook, FXOrderState, FXTrackedOrder
+#include "fx_order_gateway.h"// for IOrderGateway
+#include "fx_order_intent.h" // for FXOrderIntent, FXOrderSubmission, FXSymbolTable
+#include "fx_task_pool.h"    // for FXTaskPool
+
+namespace
+{
+// OrderId is Numeric in Trade Responses; Also Accept the String Form
+std::int64_t read_order_id(nlohmann::json const& order_id) noexcept
+{
+    if (order_id.is_number_integer())
+    {
+        return order_id.get<std::int64_t>();
+    }
+    std::int64_t value = 0;
+    if (order_id.is_string())
+    {
+        std::string const& text = order_id.get_ref<std::string const&>();
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    }
+    return value;
+}
+}// namespace
+
+namespace fxordermgmt
+{
+
+FXOrderExecutor::FXOrderExecutor(IOrderGateway& gateway, FXSymbolTable const& symbol_table, FXExecutionTiming timing)
+    : gateway(gateway), symbol_table(symbol_table), timing(timing)
+{
+}
+
+std::expected<bool, FXException> FXOrderExecutor::execute(std::vector<FXOrderIntent>& order_intents, std::size_t max_concurrent_orders)
+{
+    // Submit -> Confirm Fills -> Resize to the Unfilled Remainder, Until Every Intent is Met or the Rounds Run Out
+    order_book.clear_terminal_orders();
+    for (int round = 1; ! order_intents.empty() && round <= MAX_EXECUTION_ROUNDS; ++round)
+    {
+        std::vector<FXOrderSubmission> const submissions = submit_orders(order_intents, max_concurrent_orders);
+        gateway.invalidate_open_positions();
+        // ------------
+        // Notify if any errors
+        bool outcome_unknown = false;
+        for (FXOrderSubmission const& submission : submissions)
+        {
+            std::string const& symbol = symbol_table.name(submission.intent.symbol_id);
+            outcome_unknown = outcome_unknown || submission.unconfirmed;
+            if (! order_book.submit(submission))
+            {
+                BOOST_LOG_TRIVIAL(warning) << "Trading Error for: " << symbol << " " << submission.error_message;
+                continue;
+            }
+            BOOST_LOG_TRIVIAL(info) << "Order Submitted " << symbol << " " << FXOrderIntent::side_name(submission.intent.side) << " "
+                                    << submission.intent.quantity << "; OrderId: " << submission.order_id << ", Status: " << submission.status_id
+                                    << ", Filled: " << submission.filled_quantity << ", Latency: " << submission.latency.count() << "us";
+        }
+
+        auto active_orders_response = monitor_active_orders();
+        if (! active_orders_response)
+        {
+            return active_orders_response;
+        }
+
+        // Orders That Left the Active List Without a Final Status Can Only be Confirmed Against the Open Positions
+        for (FXOrderSubmission const& submission : submissions)
+        {
+            FXTrackedOrder const* order = (submission.accepted) ? order_book.find(submission.order_id) : nullptr;
+            outcome_unknown = outcome_unknown || (order && order->state == FXOrderState::UNKNOWN);
+        }
+        if (! outcome_unknown)
+        {
+            resize_from_order_book(order_intents, submissions);
+            continue;
+        }
+        auto verify_trades_response = verify_trades_opened(order_intents);
+        if (! verify_trades_response)
+        {
+            return verify_trades_response;
+        }
+    }
+    // -------------------
+    for (FXOrderIntent const& intent : order_intents)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Order Unconfirmed After " << MAX_EXECUTION_ROUNDS << " Rounds: " << symbol_table.name(intent.symbol_id);
+    }
+    return std::expected<bool, FXException> {true};
+}
+
+FXOrderBook const& FXOrderExecutor::orders() const noexcept { return order_book; }
+
+std::vector<FXOrderSubmission> FXOrderExecutor::submit_orders(std::vector<FXOrderIntent> const& order_intents, std::size_t max_concurrent_orders)
+{
+    // An Order Without a Market ID is Rejected Here, Before Any Worker Runs
+    std::vector<FXOrderSubmission> submissions(order_intents.size());
+    for (std::size_t x = 0; x < order_intents.size(); ++x)
+    {
+        submissions[x].intent = order_intents[x];
+        if (! gateway.resolve_market_id(order_intents[x].symbol_id))
+        {
+            submissions[x].error_message = "Market ID Unavailable";
+        }
+    }
+
+    // Symbols are Independent | At Most (max_concurrent_orders) Orders in Flight
+    FXTaskPool::parallel_for(order_intents.size(), max_concurrent_orders, [&](std::size_t x) {
+        FXOrderSubmission& submission = submissions[x];
+        if (! submission.error_message.empty())
+        {
+            return;
+        }
+        auto const start = std::chrono::steady_clock::now();
+        auto trade_order_response = gateway.trade_order(submission.intent);
+        submission.latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        if (! trade_order_response)
+        {
+            submission.error_message = trade_order_response.error().what();
+            submission.unconfirmed = true;
+            return;
+        }
+        FXOrderBook::read_trade_response(trade_order_response.value(), submission);
+    });
+    // -------------------
+    return submissions;
+}
+
+std::expected<bool, FXException> FXOrderExecutor::monitor_active_orders()
+{
+    auto deadline = std::chrono::steady_clock::now() + timing.fill_confirmation_deadline;
+    std::chrono::milliseconds fill_poll_interval = timing.fill_poll_initial_interval;
+    while (order_book.working_orders())
+    {
+        auto active_orders_response = gateway.list_active_orders();
+        if (! active_orders_response)
+        {
+            return std::expected<bool, FXException> {std::unexpect, std::move(active_orders_response.error())};
+        }
+        nlohmann::json const& active_orders_json = active_orders_response.value()["ActiveOrders"];
+        if (! active_orders_json.is_array())
+        {
+            return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(), "JSON Key Error"};
+        }
+
+        bool const past_deadline = std::chrono::steady_clock::now() >= deadline;
+        std::vector<std::int64_t> listed_order_ids;
+        for (auto const& order : active_orders_json)
+        {
+            nlohmann::json const& trade_order = order["TradeOrder"];
+            int const status = trade_order["StatusId"];
+            // ---------------------------
+            // Suspended (6), Yellow Card (8) & Red Card (10)
+            if (status == 6 || status == 8 || status == 10)
+            {
+                return std::expected<bool, FXException> {
+                    std::unexpect, std::source_location::current().function_name(), "Major Order Status Error: " + std::to_string(status)};
+            }
+            std::int64_t const order_id = read_order_id(trade_order["OrderId"]);
+            if (! order_book.find(order_id))
+            {
+                continue;
+            }
+            listed_order_ids.push_back(order_id);
+            order_book.apply_status(order_id, status);
+        }
+        for (std::int64_t const order_id : order_book.mark_unlisted_orders(listed_order_ids))
+        {
+            BOOST_LOG_TRIVIAL(info) << "Order Left Active List: " << order_id << "; Confirming Against Open Positions";
+        }
+
+        // Pending & Working Orders Alike | Left Live, the Next Round Would Submit the Full Quantity on Top of Them
+        if (past_deadline)
+        {
+            for (std::int64_t const order_id : order_book.live_order_ids())
+            {
+                auto cancel_order_response = gateway.cancel_order(order_id);
+                if (! cancel_order_response)
+                {
+                    return std::expected<bool, FXException> {std::unexpect, std::move(cancel_order_response.error())};
+                }
+                order_book.transition(order_id, FXOrderState::CANCELLED);
+                BOOST_LOG_TRIVIAL(warning) << "Canceled Order: " << cancel_order_response.value();
+            }
+        }
+
+        if (! order_book.working_orders() || past_deadline)
+        {
+            break;
+        }
+        auto const time_left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        // A Shutdown Ends the Wait at Once; the Next Poll Cancels Whatever is Still Live
+        if (! gateway.wait_for(std::max(std::chrono::milliseconds {0}, std::min(fill_poll_interval, time_left))))
+        {
+            deadline = std::chrono::steady_clock::now();
+        }
+        fill_poll_interval = std::min(fill_poll_interval * 2, timing.fill_poll_max_interval);
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+void FXOrderExecutor::resize_from_order_book(std::vector<FXOrderIntent>& order_intents, std::vector<FXOrderSubmission> const& submissions) const
+{
+    // Submissions Match the Intents by Index
+    std::vector<FXOrderIntent> remaining_intents;
+    for (std::size_t x = 0; x < order_intents.size(); ++x)
+    {
+        FXOrderIntent intent = order_intents[x];
+        FXTrackedOrder const* order = (submissions[x].accepted) ? order_book.find(submissions[x].order_id) : nullptr;
+        int const filled_quantity = (order) ? order->filled_quantity : 0;
+        int const live_quantity = order_book.outstanding_exposure(intent.symbol_id);
+        intent.quantity -= filled_quantity + ((intent.side == FXOrderSide::BUY) ? live_quantity : -live_quantity);
+        if (intent.quantity > 0)
+        {
+            remaining_intents.push_back(intent);
+        }
+    }
+    order_intents = std::move(remaining_intents);
+}
+
+std::expected<bool, FXException> FXOrderExecutor::verify_trades_opened(std::vector<FXOrderIntent>& order_intents)
+{
+    auto open_positions_response = gateway.load_open_positions();
+    if (! open_positions_response)
+    {
+        return open_positions_response;
+    }
+    nlohmann::json const& open_positions = gateway.open_positions();
+
+    // Intents Without an Open Position Either Still Need to Open or Have Finished Closing
+    std::vector<FXOrderIntent> remaining_intents;
+    for (FXOrderIntent intent : order_intents)
+    {
+        auto const position = std::find_if(open_positions.begin(), open_positions.end(), [&](nlohmann::json const& open_position) {
+            return symbol_table.find(open_position["MarketName"].get_ref<std::string const&>()) == intent.symbol_id;
+        });
+        if (position == open_positions.end())
+        {
+            if (intent.final_quantity)
+            {
+                intent.quantity = intent.final_quantity;
+                remaining_intents.push_back(intent);
+            }
+            continue;
+        }
+        // ------------
+        int const existing_quantity = (*position)["Quantity"];
+        auto const existing_side = FXOrderIntent::parse_side((*position)["Direction"].get_ref<std::string const&>());
+        if (intent.side != existing_side)
+        {
+            intent.quantity = existing_quantity + intent.final_quantity;
+            remaining_intents.push_back(intent);
+        }
+        else if (existing_quantity < intent.final_quantity)
+        {
+            intent.quantity = intent.final_quantity - existing_quantity;
+            remaining_intents.push_back(intent);
+        }
+    }
+    order_intents = std::move(remaining_intents);
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+}// namespace fxordermgmt
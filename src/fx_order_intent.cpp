@@ -0,0 +1,58 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_order_intent.h"
+
+#include <cstddef>    // for size_t
+#include <optional>   // for optional, nullopt
+#include <string>     // for string
+#include <string_view>// for string_view
+
+#include "fx_trade_rules.h"// for FXTradeDecision
+
+namespace fxordermgmt
+{
+
+FXOrderIntent FXOrderIntent::from_decision(fx_symbol_id_t symbol_id, FXTradeDecision const& decision) noexcept
+{
+    return FXOrderIntent {symbol_id, (decision.is_buy) ? FXOrderSide::BUY : FXOrderSide::SELL, decision.quantity, decision.final_quantity};
+}
+
+std::optional<FXOrderSide> FXOrderIntent::parse_side(std::string_view direction) noexcept
+{
+    if (direction == "buy")
+    {
+        return FXOrderSide::BUY;
+    }
+    if (direction == "sell")
+    {
+        return FXOrderSide::SELL;
+    }
+    return std::nullopt;
+}
+
+FXOrderSide FXOrderIntent::opposite(FXOrderSide side) noexcept { return (side == FXOrderSide::BUY) ? FXOrderSide::SELL : FXOrderSide::BUY; }
+
+fx_symbol_id_t FXSymbolTable::intern(std::string_view symbol)
+{
+    if (auto const it = ids.find(symbol); it != ids.end())
+    {
+        return it->second;
+    }
+    fx_symbol_id_t const symbol_id = static_cast<fx_symbol_id_t>(names.size());
+    ids.emplace(std::string(symbol), symbol_id);
+    names.emplace_back(symbol);
+    return symbol_id;
+}
+
+std::optional<fx_symbol_id_t> FXSymbolTable::find(std::string_view symbol) const
+{
+    auto const it = ids.find(symbol);
+    return (it != ids.end()) ? std::optional<fx_symbol_id_t> {it->second} : std::nullopt;
+}
+
+std::string const& FXSymbolTable::name(fx_symbol_id_t symbol_id) const { return names.at(symbol_id); }
+
+std::size_t FXSymbolTable::size() const noexcept { return names.size(); }
+
+}// namespace fxordermgmt
@@ -3,18 +3,24 @@
 
 #include "fx_order_management.h"
 
-#include <algorithm>       // for remove, find
-#include <chrono>          // for system_clock
+#include <algorithm>       // for remove, find, max, min
+#include <chrono>          // for system_clock, steady_clock, milliseconds, ceil
 #include <cmath>           // for round
+#include <cstdint>         // for int64_t
 #include <ctime>           // for size_t, ctime
 #include <expected>        // for expected
-#include <filesystem>      // for is_directory, create_directories...
+#include <filesystem>      // for is_directory, create_directories, rename...
 #include <fstream>         // for basic_ostream
 #include <initializer_list>// for initializer_list
 #include <iostream>        // for cerr, cout
+#include <memory>          // for make_unique
+#include <mutex>           // for lock_guard
+#include <optional>        // for optional, nullopt
+#include <shared_mutex>    // for shared_mutex, shared_lock
 #include <source_location> // for current, function_name...
-#include <string>          // for operator==, hash
-#include <unistd.h>        // for sleep, NULL
+#include <string>          // for operator==, hash, to_string
+#include <system_error>    // for error_code
+#include <unistd.h>        // for NULL
 #include <unordered_map>   // for unordered_map
 #include <utility>         // for pair
 #include <vector>          // for vector
@@ -23,10 +29,76 @@
 #include "gain_capital_api/gain_capital_client.h"// for GCapiClient
 #include "json/json.hpp"                         // for json_ref, basi...
 
-#include "fx_exception.h"    // for FXException
-#include "fx_market_time.h"  // for FXMarketTime
-#include "fx_trading_model.h"// for FXTradingModel
-#include "fx_utilities.h"    // for FXUtilities
+#include "fx_bar_series.h"             // for FXBarSeries
+#include "fx_control_channel.h"        // for FXControlChannel, FXControlCommand
+#include "fx_event_loop.h"             // for FXEventLoop
+#include "fx_exception.h"              // for FXException
+#include "fx_fetch_pool.h"             // for FXFetchPool
+#include "fx_file_watcher.h"           // for FXFileWatcher
+#include "fx_market_time.h"            // for FXMarketTime
+#include "fx_order_executor.h"         // for FXOrderExecutor
+#include "fx_order_intent.h"           // for FXOrderIntent, FXOrderSide, FXSymbolTable
+#include "fx_price_bar_parser.h"       // for FXPriceBarParser, FXPriceBarsSummary
+#include "fx_report_worker.h"          // for FXReportWorker, FXReportSnapshot, FXReportPosition
+#include "fx_report_writer.h"          // for FXReportWriter, FXPositionPerformance
+#include "fx_task_pool.h"              // for FXTaskPool
+#include "fx_trade_rules.h"            // for FXTradeRules, FXPosition
+#include "fx_trading_model_interface.h"// for ITradingModel
+#include "fx_trading_model_registry.h" // for FXTradingModelRegistry, FXModelConfig
+#include "fx_utilities.h"              // for FXUtilities
+
+namespace
+{
+// Bar Readiness Polling | Backoff Doubles Up to the Max Interval, or 1/60 of the Bar Interval if Longer
+constexpr std::chrono::milliseconds BAR_POLL_INITIAL_INTERVAL {100};
+constexpr std::chrono::milliseconds BAR_POLL_MAX_INTERVAL {1000};
+
+// Failed Symbols Retry on Their Own Schedule, but Not Within the Cutoff Before the Next Bar
+constexpr std::chrono::seconds PRICE_RETRY_INTERVAL {10};
+constexpr std::chrono::seconds PRICE_RETRY_CUTOFF {20};
+
+// Accepts "Model_Name" or {"Model": "Model_Name", "Parameters": {"Key": Number}}
+bool parse_model_config(nlohmann::json const& json_value, fxordermgmt::FXModelConfig& config)
+{
+    config = fxordermgmt::FXModelConfig {};
+    if (json_value.is_string())
+    {
+        config.model_name = json_value;
+    }
+    else if (json_value.is_object() && json_value.contains("Model") && json_value["Model"].is_string())
+    {
+        config.model_name = json_value["Model"];
+        if (json_value.contains("Parameters"))
+        {
+            if (! json_value["Parameters"].is_object())
+            {
+                return false;
+            }
+            for (auto const& [key, value] : json_value["Parameters"].items())
+            {
+                if (! value.is_number())
+                {
+                    return false;
+                }
+                config.parameters[key] = value;
+            }
+        }
+    }
+    else
+    {
+        return false;
+    }
+    // -------------------
+    return fxordermgmt::FXTradingModelRegistry::instance().contains(config.model_name);
+}
+
+// Gain Capital Trade Payload | {"EUR/USD": {"Quantity": 1000, "Direction": "buy", "Final Quantity": 1000}}
+nlohmann::json trade_payload(fxordermgmt::FXOrderIntent const& intent, std::string const& symbol)
+{
+    return nlohmann::json {{symbol, {{"Quantity", intent.quantity}, {"Direction", fxordermgmt::FXOrderIntent::side_name(intent.side)},
+                                        {"Final Quantity", intent.final_quantity}}}};
+}
+}// namespace
 
 namespace fxordermgmt
 {
@@ -71,22 +143,28 @@ std::expected<bool, FXException> FXOrderManagement::initialize_order_management(
     std::string password = password_response.value();
 
     // Check if the Market is Open
+    fx_market_time.set_event_loop(&event_loop);
     auto forex_market_time_response = fx_market_time.wait_till_forex_market_is_open();
     if (! forex_market_time_response)
     {
         return forex_market_time_response;
     }
+    if (event_loop.shutdown_requested())
+    {
+        return std::expected<bool, FXException> {true};
+    }
 
     // Set Vector Sizes & Initialize Trading Models
     for (std::string const& symbol : fx_symbols_to_trade)
     {
-        position_multiplier[symbol] = 1;
-        open_prices_map[symbol].resize(num_data_points);
-        high_prices_map[symbol].resize(num_data_points);
-        low_prices_map[symbol].resize(num_data_points);
-        close_prices_map[symbol].resize(num_data_points);
-        datetime_map[symbol].resize(num_data_points);
-        initialize_trading_model(symbol);
+        fx_symbol_id_t const symbol_id = add_symbol(symbol);
+        trading_symbols.push_back(symbol_id);
+        symbol_price_bars[symbol_id] = FXBarSeries(static_cast<std::size_t>(num_data_points));
+        auto trading_model_response = initialize_trading_model(symbol_id);
+        if (! trading_model_response)
+        {
+            return trading_model_response;
+        }
     }
 
     // Start Gain Capital Session
@@ -96,6 +174,23 @@ std::expected<bool, FXException> FXOrderManagement::initialize_order_management(
         return gain_capital_response;
     }
 
+    /* Blocks SIGINT & SIGTERM for the process, so it follows the password prompt and the blocking
+       authentication, where Ctrl-C must still end the program. It precedes every thread the system
+       starts, so they all inherit the mask. */
+    auto event_loop_response = event_loop.initialize();
+    if (! event_loop_response)
+    {
+        return event_loop_response;
+    }
+
+    // OHLC Requests Run Here So Each Symbol's Result is Handled as Soon as it Arrives
+    fetch_pool = std::make_unique<FXFetchPool>();
+    auto fetch_pool_response = fetch_pool->start(static_cast<std::size_t>(max_concurrent_requests));
+    if (! fetch_pool_response)
+    {
+        return fetch_pool_response;
+    }
+
     // Create File for Logging Output
     if (file_logging)
     {
@@ -115,14 +210,88 @@ std::expected<bool, FXException> FXOrderManagement::initialize_order_management(
 
 std::expected<bool, FXException> FXOrderManagement::run_order_management_system()
 {
+    if (event_loop.shutdown_requested())
+    {
+        return std::expected<bool, FXException> {true};
+    }
+
     BOOST_LOG_TRIVIAL(info) << "FX Order Management - Currently Running";
     if (! emergency_close)
     {
-        for (std::string const& symbol : execute_list) { initialize_trading_model(symbol); }
+        for (fx_symbol_id_t const symbol_id : execute_list)
+        {
+            auto trading_model_response = initialize_trading_model(symbol_id);
+            if (! trading_model_response)
+            {
+                return trading_model_response;
+            }
+        }
     }
-    while (! fx_market_time.is_market_closed())
+
+    // Report Files & Report-Only API Calls Never Hold Up the Update Loop
+    report_worker = std::make_unique<FXReportWorker>([this](FXReportSnapshot const& snapshot) {
+        auto profit_report_response = write_profit_report(snapshot);
+        if (! profit_report_response)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Profit Report Failed: " << profit_report_response.error().where() << " "
+                                     << profit_report_response.error().what();
+        }
+    });
+
+    // Out-of-Band Close Commands | The System Runs Without Them if the Socket Can't be Created
+    auto control_channel_response = control_channel.listen(interface_directory() + "/fx_control.sock");
+    if (! control_channel_response)
     {
-        auto trade_order_response = trade_order_sequence();
+        BOOST_LOG_TRIVIAL(warning) << "Control Channel Unavailable: " << control_channel_response.error().what();
+    }
+    else
+    {
+        auto control_source_response = event_loop.add_source(control_channel.native_handle(), [this]() {
+            auto control_response = handle_control_commands();
+            if (! control_response)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Control Command Failed: " << control_response.error().where() << " " << control_response.error().what();
+            }
+        });
+        if (! control_source_response)
+        {
+            return control_source_response;
+        }
+    }
+
+    auto fetch_source_response = event_loop.add_source(fetch_pool->native_handle(), [this]() { handle_price_requests(); });
+    if (! fetch_source_response)
+    {
+        return fetch_source_response;
+    }
+
+    // Watch the Active Management File from the Start | Edits Apply Between Bars
+    auto active_mgmt_response = update_active_management();
+    if (! active_mgmt_response)
+    {
+        return active_mgmt_response;
+    }
+    auto watcher_source_response = event_loop.add_source(active_management_watcher.native_handle(), [this]() {
+        if (! active_management_watcher.changed())
+        {
+            return;
+        }
+        auto read_active_mgmt_response = read_active_management_file();
+        if (! read_active_mgmt_response)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Active Management Update Failed: " << read_active_mgmt_response.error().where() << " "
+                                     << read_active_mgmt_response.error().what();
+        }
+    });
+    if (! watcher_source_response)
+    {
+        return watcher_source_response;
+    }
+
+    while (! fx_market_time.is_market_closed() && ! event_loop.shutdown_requested())
+    {
+        // Pipelines Trade Each Symbol's Bars as They Merge; a Full Cycle Runs Only When None Did, Keeping Exits & Reports Current
+        auto trade_order_response = (bars_traded) ? std::expected<bool, FXException> {true} : trade_order_sequence();
         auto pause_next_bar_response = pause_till_next_bar();
 
         if (! trade_order_response)
@@ -148,6 +317,14 @@ std::expected<bool, FXException> FXOrderManagement::run_order_management_system(
 
         BOOST_LOG_TRIVIAL(info) << "FX Order Management - Update Loop";
     }
+
+    if (event_loop.shutdown_requested())
+    {
+        BOOST_LOG_TRIVIAL(info) << "FX Order Management - Shutdown Requested";
+    }
+
+    // Flushes the Last Snapshot
+    report_worker.reset();
     // -------------------
     return std::expected<bool, FXException> {true};
 }
@@ -158,19 +335,21 @@ std::expected<bool, FXException> FXOrderManagement::run_order_management_system(
 
 std::expected<bool, FXException> FXOrderManagement::trade_order_sequence()
 {
+    // New Bars Start a New Cycle
+    invalidate_open_positions();
+
     auto trade_map_response = build_trades();
     if (! trade_map_response)
     {
         return std::expected<bool, FXException> {std::unexpect, std::move(trade_map_response.error())};
     }
 
-    std::vector<nlohmann::json> trade_map = trade_map_response.value();
+    std::vector<FXOrderIntent> order_intents = std::move(trade_map_response.value());
 
     // Place Trades
-    if (! trade_map.empty())
+    if (! order_intents.empty())
     {
-        execution_loop_count = 0;
-        auto execute_signals_response = execute_signals(trade_map);
+        auto execute_signals_response = execute_signals(order_intents);
         if (! execute_signals_response)
         {
             return execute_signals_response;
@@ -183,7 +362,7 @@ std::expected<bool, FXException> FXOrderManagement::trade_order_sequence()
         return profit_report_response;
     }
 
-    auto read_active_mgmt_response = read_active_management_file();
+    auto read_active_mgmt_response = update_active_management();
     if (! read_active_mgmt_response)
     {
         return read_active_mgmt_response;
@@ -192,88 +371,54 @@ std::expected<bool, FXException> FXOrderManagement::trade_order_sequence()
     return std::expected<bool, FXException> {true};
 }
 
-std::expected<std::vector<nlohmann::json>, FXException> FXOrderManagement::build_trades()
+std::expected<std::vector<FXOrderIntent>, FXException> FXOrderManagement::build_trades()
 {
-    std::vector<nlohmann::json> trades_vect;
-    auto open_positions_response = session.list_open_positions();
+    std::vector<FXOrderIntent> order_intents;
+    auto open_positions_response = load_open_positions();
     if (! open_positions_response)
     {
-        std::expected<std::vector<nlohmann::json>, FXException> {
-            std::unexpect, open_positions_response.error().where(), open_positions_response.error().what()};
+        return std::expected<std::vector<FXOrderIntent>, FXException> {std::unexpect, std::move(open_positions_response.error())};
     }
-    nlohmann::json open_positions = open_positions_response.value()["OpenPositions"];
+    nlohmann::json const& open_positions = open_positions_snapshot;
     // -------------------
     if (! fx_market_time.is_forex_market_close_only() && ! emergency_close)
     {
-        for (auto position : open_positions)
+        for (auto const& position : open_positions)
         {
-            std::string symbol = position["MarketName"];
+            auto const symbol_id = symbol_table.find(position["MarketName"].get_ref<std::string const&>());
             // ------------
-            if (find(execute_list.begin(), execute_list.end(), symbol) != execute_list.end())
+            if (symbol_id && execute_set[*symbol_id])
             {
-                nlohmann::json trades_map = {};
-                execute_list.erase(remove(execute_list.begin(), execute_list.end(), symbol), execute_list.end());
-
-                int const base_quantity = (position_multiplier.count(symbol)) ? round(position_multiplier[symbol] * order_position_size / 1000) * 1000
-                                                                              : order_position_size;
-                int const signal = trading_model_map.at(symbol).send_trading_signal();
-                int const live_quantity = position["Quantity"];
-                std::string const direction = position["Direction"];
-                std::string const new_direction = (direction == "buy") ? "sell" : "buy";
+                execute_set[*symbol_id] = false;
+
+                int const base_quantity = FXTradeRules::base_quantity(position_multiplier[*symbol_id], order_position_size);
+                int const signal = trading_models[*symbol_id]->send_trading_signal(symbol_price_bars[*symbol_id]);
+                auto const side = FXOrderIntent::parse_side(position["Direction"].get_ref<std::string const&>());
                 // -------------------
-                if (direction == "buy")
-                {
-                    if (signal == 1 && live_quantity < base_quantity)
-                    {
-                        trades_map[symbol] = {
-                            {"Quantity", base_quantity - live_quantity}, {"Direction", direction}, {"Final Quantity", base_quantity}};
-                    }
-                    else if (signal == 0)
-                    {
-                        trades_map[symbol] = {{"Quantity", live_quantity}, {"Direction", new_direction}, {"Final Quantity", 0}};
-                    }
-                    else if (signal == -1)
-                    {
-                        trades_map[symbol] = {
-                            {"Quantity", base_quantity + live_quantity}, {"Direction", new_direction}, {"Final Quantity", base_quantity}};
-                    }
-                }
-                else if (direction == "sell")
+                if (side)
                 {
-                    if (signal == -1 && live_quantity < base_quantity)
-                    {
-                        trades_map[symbol] = {
-                            {"Quantity", base_quantity - live_quantity}, {"Direction", direction}, {"Final Quantity", base_quantity}};
-                    }
-                    else if (signal == 0)
-                    {
-                        trades_map[symbol] = {{"Quantity", live_quantity}, {"Direction", new_direction}, {"Final Quantity", 0}};
-                    }
-                    else if (signal == 1)
+                    auto const decision = FXTradeRules::decide(signal, FXPosition {position["Quantity"], *side == FXOrderSide::BUY}, base_quantity);
+                    if (decision)
                     {
-                        trades_map[symbol] = {
-                            {"Quantity", base_quantity + live_quantity}, {"Direction", new_direction}, {"Final Quantity", base_quantity}};
+                        order_intents.push_back(FXOrderIntent::from_decision(*symbol_id, *decision));
                     }
                 }
-                trades_vect.emplace_back(trades_map);
             }
         }
         // -------------------
-        // Open New Positions
-        if (! execute_list.empty())
+        // Open New Positions | Symbols Still Flagged Have No Open Position
+        for (fx_symbol_id_t const symbol_id : execute_list)
         {
-            for (auto const& symbol : execute_list)
+            if (! execute_set[symbol_id])
             {
-                nlohmann::json trades_map = {};
-                int const position_signal = trading_model_map.at(symbol).send_trading_signal();
-                int const base_quantity = (position_multiplier.count(symbol)) ? round(position_multiplier[symbol] * order_position_size / 1000) * 1000
-                                                                              : order_position_size;
-                if (position_signal && base_quantity)
-                {
-                    std::string const direction = (position_signal == 1) ? "buy" : "sell";
-                    trades_map[symbol] = {{"Quantity", base_quantity}, {"Direction", direction}, {"Final Quantity", base_quantity}};
-                    trades_vect.emplace_back(trades_map);
-                }
+                continue;
+            }
+            int const position_signal = trading_models[symbol_id]->send_trading_signal(symbol_price_bars[symbol_id]);
+            int const base_quantity = FXTradeRules::base_quantity(position_multiplier[symbol_id], order_position_size);
+            auto const decision = FXTradeRules::decide(position_signal, FXPosition {}, base_quantity);
+            if (decision)
+            {
+                order_intents.push_back(FXOrderIntent::from_decision(symbol_id, *decision));
             }
         }
     }
@@ -281,17 +426,32 @@ std::expected<std::vector<nlohmann::json>, FXException> FXOrderManagement::build
     // Exit Only Positions
     else
     {
-        for (auto position : open_positions)
+        order_intents = build_exit_trades({}, true);
+    }
+    clear_execute_set();
+    // -------------------
+    return std::expected<std::vector<FXOrderIntent>, FXException> {std::move(order_intents)};
+}
+
+std::vector<FXOrderIntent> FXOrderManagement::build_exit_trades(std::vector<fx_symbol_id_t> const& symbol_ids, bool all_symbols)
+{
+    std::vector<FXOrderIntent> order_intents;
+    for (auto const& position : open_positions_snapshot)
+    {
+        fx_symbol_id_t const symbol_id = add_symbol(position["MarketName"].get_ref<std::string const&>());
+        auto const side = FXOrderIntent::parse_side(position["Direction"].get_ref<std::string const&>());
+        if (side && (all_symbols || std::find(symbol_ids.begin(), symbol_ids.end(), symbol_id) != symbol_ids.end()))
         {
-            nlohmann::json trades_map = {};
-            std::string const symbol = position["MarketName"];
-            std::string const new_direction = (position["Direction"] == "buy") ? "sell" : "buy";
-            trades_map[symbol] = {{"Quantity", static_cast<int>(position["Quantity"])}, {"Direction", new_direction}, {"Final Quantity", 0}};
-            trades_vect.emplace_back(trades_map);
+            order_intents.push_back(FXOrderIntent {symbol_id, FXOrderIntent::opposite(*side), static_cast<int>(position["Quantity"]), 0});
         }
     }
-    // -------------------
-    return std::expected<std::vector<nlohmann::json>, FXException> {trades_vect};
+    return order_intents;
+}
+
+void FXOrderManagement::clear_execute_set() noexcept
+{
+    for (fx_symbol_id_t const symbol_id : execute_list) { execute_set[symbol_id] = false; }
+    execute_list.clear();
 }
 
 /*  * This Function is Not Called
@@ -300,7 +460,7 @@ void FXOrderManagement::return_tick_history(std::vector<std::string> const& symb
 {
     for (auto const& symbol : symbols_list)
     {
-        auto prices_response = session.get_prices(symbol, num_data_points);
+        auto prices_response = session.get_prices(symbol, static_cast<std::size_t>(num_data_points));
         if (! prices_response)
         {
             // throw FXException { prices_response.error().where(), prices_response.error().what()};
@@ -312,259 +472,406 @@ void FXOrderManagement::return_tick_history(std::vector<std::string> const& symb
     }
 }
 
-void FXOrderManagement::return_price_history(std::vector<std::string> const& symbols_list)
+void FXOrderManagement::dispatch_price_request(fx_symbol_id_t symbol_id, std::size_t target_timestamp)
 {
-    BOOST_LOG_TRIVIAL(info) << "FX Order Management - Attempting to Fetch Price History";
+    if (fetch_in_flight[symbol_id])
+    {
+        return;
+    }
 
-    execute_list = {};
+    std::size_t const timestamp_now =
+        static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    std::size_t const bar_seconds = static_cast<std::size_t>(update_frequency_seconds);
+
+    // Incremental Mode Requests the Newest Stored Bar Again, Along with Every Bar After It
+    OHLCRequest& request = ohlc_requests[symbol_id];
+    request.target_timestamp = target_timestamp;
+    request.stored_timestamp = static_cast<std::size_t>(symbol_bar_timestamp[symbol_id]);
+    request.bars_missing = (request.stored_timestamp && timestamp_now > request.stored_timestamp)
+                               ? (timestamp_now - request.stored_timestamp) / bar_seconds + 1
+                               : 0;
+    request.incremental = incremental_update && request.stored_timestamp && request.bars_missing < static_cast<std::size_t>(num_data_points);
+
+    fetch_in_flight[symbol_id] = true;
+    next_fetch_time[symbol_id] = std::chrono::system_clock::time_point::max();
+    /* Trading symbols have their market ids resolved in gain_capital_session, so the request only reads the client;
+       the shared lock keeps it clear of the market id lookups the trading thread makes while it is in flight. The
+       worker writes nothing but its own slot. */
+    fetch_pool->submit(symbol_id, [this, &request, symbol = symbol_table.name(symbol_id), timestamp_now]() {
+        std::size_t const span = static_cast<std::size_t>(update_span);
+        std::shared_lock<std::shared_mutex> session_lock(session_mutex);
+        request.response = (request.incremental) ? session.get_ohlc(symbol, update_interval, request.bars_missing, span,
+                                                       request.stored_timestamp, timestamp_now)
+                                                 : session.get_ohlc(symbol, update_interval, static_cast<std::size_t>(num_data_points), span);
+    });
+}
 
-    for (auto const& symbol : symbols_list)
+void FXOrderManagement::handle_price_requests()
+{
+    std::vector<std::size_t> const finished_ids = fetch_pool->take_completed();
+    if (finished_ids.empty())
     {
-        auto ohlc_response = session.get_ohlc(symbol, update_interval, num_data_points, update_span);
-        try
+        return;
+    }
+
+    clear_execute_set();
+    auto const timestamp_now = std::chrono::system_clock::now();
+    std::chrono::milliseconds const max_poll_interval = std::max(
+        BAR_POLL_MAX_INTERVAL, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::seconds {update_frequency_seconds}) / 60);
+
+    std::vector<fx_symbol_id_t> error_list;
+    for (std::size_t const finished_id : finished_ids)
+    {
+        fx_symbol_id_t const symbol_id = static_cast<fx_symbol_id_t>(finished_id);
+        fetch_in_flight[symbol_id] = false;
+
+        // A Bar Not Yet Published is Polled Again with Short Backoff; Past the Poll Deadline it Counts as a Failure
+        bool const wait_for_publication = awaiting_bar[symbol_id] && timestamp_now < bar_poll_deadline;
+        if (! merge_price_history(symbol_id, wait_for_publication))
         {
-            if (! ohlc_response)
-            {
-                throw FXException {ohlc_response.error().where(), ohlc_response.error().what()};
-            }
+            next_fetch_time[symbol_id] = std::min(timestamp_now + poll_interval[symbol_id], bar_poll_deadline);
+            poll_interval[symbol_id] = std::min(poll_interval[symbol_id] * 2, max_poll_interval);
+            continue;
+        }
 
-            nlohmann::json ohlc_json = ohlc_response.value();
+        // Publication Delay is Measured from the Timestamp of the Awaited Bar
+        if (bar_ready_polling && awaiting_bar[symbol_id] && execute_set[symbol_id])
+        {
+            std::chrono::system_clock::time_point const next_bar_time {std::chrono::seconds(static_cast<std::int64_t>(next_bar_timestamp))};
+            bar_publication_delay_ms[symbol_id] = std::chrono::duration_cast<std::chrono::milliseconds>(timestamp_now - next_bar_time).count();
+            BOOST_LOG_TRIVIAL(debug) << "OHLC Bar Published " << symbol_table.name(symbol_id)
+                                     << "; Observed Delay: " << bar_publication_delay_ms[symbol_id] << " ms";
+        }
+        awaiting_bar[symbol_id] = false;
 
-            std::string const last_bar_datetime = ohlc_json["PriceBars"].back()["BarDate"].dump();
+        if (price_update_failure_count[symbol_id] > max_retry_failures)
+        {
+            error_list.push_back(symbol_id);
+            position_multiplier[symbol_id] = 0;
 
-            if (last_bar_datetime == "null")
-            {
-                throw FXException {std::source_location::current().function_name(), "JSON Key Error"};
-            }
+            BOOST_LOG_TRIVIAL(error) << "Too Many Errors: " << symbol_table.name(symbol_id) << " Removed from Trading";
+        }
+        else if (price_update_failure_count[symbol_id])
+        {
+            next_fetch_time[symbol_id] = timestamp_now + PRICE_RETRY_INTERVAL;
+        }
+    }
+
+    for (fx_symbol_id_t const symbol_id : error_list)
+    {
+        price_update_failure_count[symbol_id] = 0;
+        next_fetch_time[symbol_id] = std::chrono::system_clock::time_point::max();
+        trading_symbols.erase(remove(trading_symbols.begin(), trading_symbols.end(), symbol_id), trading_symbols.end());
+    }
+
+    // Trade the Symbols Whose Bars Just Merged; Slower Symbols Trade When Their Own Requests Finish
+    if (! execute_list.empty())
+    {
+        bars_traded = true;
+        auto trade_order_response = trade_order_sequence();
+        if (! trade_order_response && pipeline_response)
+        {
+            pipeline_response = std::move(trade_order_response);
+        }
+    }
+}
+
+bool FXOrderManagement::merge_price_history(fx_symbol_id_t symbol_id, bool wait_for_publication)
+{
+    OHLCRequest& request = ohlc_requests[symbol_id];
+    std::string const& symbol = symbol_table.name(symbol_id);
+    bool const incremental = request.incremental;
+    std::size_t const stored_timestamp = request.stored_timestamp;
+    auto& ohlc_response = request.response;
+    try
+    {
+        if (! ohlc_response)
+        {
+            throw FXException {ohlc_response.error().where(), ohlc_response.error().what()};
+        }
+
+        nlohmann::json const& ohlc_json = ohlc_response.value();
+        if (! ohlc_json.contains("PriceBars") || ! ohlc_json["PriceBars"].is_array() || ohlc_json["PriceBars"].empty())
+        {
+            throw FXException {std::source_location::current().function_name(), "JSON Key Error"};
+        }
+
+        nlohmann::json const& ohlc_bars = ohlc_json["PriceBars"];
+        nlohmann::json const& last_bar = ohlc_bars.back();
+        auto const last_bar_datetime = (last_bar.contains("BarDate") && last_bar["BarDate"].is_string())
+                                           ? FXPriceBarParser::parse_bar_date(last_bar["BarDate"].get_ref<std::string const&>())
+                                           : std::nullopt;
+        if (! last_bar_datetime)
+        {
+            throw FXException {std::source_location::current().function_name(), "JSON Key Error"};
+        }
 
-            std::size_t last_timestamp = std::stoi(last_bar_datetime.substr(6, 10));
+        std::size_t const last_timestamp = static_cast<std::size_t>(*last_bar_datetime);
 
-            if (last_timestamp < next_bar_timestamp)
+        // The Awaited Bar Counts Only Once Closed, so a Bar Still in Progress is Never Traded On
+        std::int64_t const timestamp_now = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        bool const bar_closed = last_timestamp >= request.target_timestamp
+                                && FXPriceBarParser::bar_closed(ohlc_bars, static_cast<std::int64_t>(request.target_timestamp),
+                                    update_frequency_seconds, timestamp_now);
+        if (! bar_closed && wait_for_publication)
+        {
+            return false;
+        }
+        if (last_timestamp < request.target_timestamp)
+        {
+            throw FXException {std::source_location::current().function_name(), "Timestamp is Not Current"};
+        }
+        if (! bar_closed)
+        {
+            throw FXException {std::source_location::current().function_name(), "Bar is Not Closed"};
+        }
+        // Full Reload Requires the Complete History Window
+        if (! incremental && ohlc_bars.size() < static_cast<std::size_t>(num_data_points))
+        {
+            return true;
+        }
+        // ------------
+        FXBarSeries& price_bars = symbol_price_bars[symbol_id];
+        if (! incremental)
+        {
+            price_bars.clear();
+        }
+        std::int64_t const after_timestamp = (incremental) ? static_cast<std::int64_t>(stored_timestamp) : 0;
+        auto load_response = FXPriceBarParser::load_price_bars(ohlc_bars, price_bars, after_timestamp);
+        if (! load_response)
+        {
+            // Series May Be Partially Written; Force a Full Reload Next Update
+            symbol_bar_timestamp[symbol_id] = 0;
+            throw FXException {load_response.error()};
+        }
+        FXPriceBarsSummary const& summary = load_response.value();
+
+        // Models Seed Streaming State on a Full Reload or a Revised Newest Bar, & Otherwise Fold in Only the New Bars
+        if (trading_models[symbol_id] && (summary.bars_appended || summary.bars_revised))
+        {
+            ITradingModel& trading_model = *trading_models[symbol_id];
+            if (! incremental || summary.bars_revised)
             {
-                throw FXException {std::source_location::current().function_name(), "Timestamp is Not Current"};
+                trading_model.on_history_loaded(price_bars);
             }
-            // Separate Data From OHLC into Individual Vectors
-            int const data_length = ohlc_json["PriceBars"].size();
-            if (data_length >= num_data_points)
+            else
             {
-                execute_list.push_back(symbol);
-                if (price_update_failure_count.count(symbol))
-                {
-                    price_update_failure_count.erase(symbol);
-                }
-                // ------------
-                for (int x = 0; x < num_data_points; x++)
+                trading_model.on_new_bars(price_bars, summary.bars_appended);
+            }
+            if (verify_streaming_indicators)
+            {
+                auto verify_response = trading_model.verify_streaming_state(price_bars);
+                if (! verify_response)
                 {
-                    int const x1 = data_length - num_data_points + x;
-                    open_prices_map[symbol][x] = ohlc_json["PriceBars"][x1]["Open"];
-                    high_prices_map[symbol][x] = ohlc_json["PriceBars"][x1]["High"];
-                    low_prices_map[symbol][x] = ohlc_json["PriceBars"][x1]["Low"];
-                    close_prices_map[symbol][x] = ohlc_json["PriceBars"][x1]["Close"];
-                    datetime_map[symbol][x] = std::stof(ohlc_json["PriceBars"][x1]["BarDate"].dump().substr(6, 10));
+                    BOOST_LOG_TRIVIAL(warning) << "Streaming Indicator Mismatch " << symbol << "; Re-Seeding from History. Error Message: "
+                                               << verify_response.error().what();
+                    trading_model.on_history_loaded(price_bars);
                 }
             }
         }
-        catch (FXException const& e)
+        if (! summary.bars_appended)
         {
-            price_update_failure_count[symbol] += 1;
-            BOOST_LOG_TRIVIAL(warning) << "OHLC Update Failed " << symbol << "; Number of Failed Loops: " << price_update_failure_count[symbol]
-                                       << "Error Message: " << e.what();
+            throw FXException {std::source_location::current().function_name(), "No New Bars Since Last Update"};
         }
-        catch (std::invalid_argument const& e)
+
+        if (! execute_set[symbol_id])
         {
-            price_update_failure_count[symbol] += 1;
-            BOOST_LOG_TRIVIAL(warning) << "OHLC Update Failed " << symbol << "; Number of Failed Loops: " << price_update_failure_count[symbol]
-                                       << "Error Message: " << e.what() << " | Problem with std::stoi or std::stof.";
+            execute_set[symbol_id] = true;
+            execute_list.push_back(symbol_id);
         }
+        price_update_failure_count[symbol_id] = 0;
+        symbol_bar_timestamp[symbol_id] = static_cast<std::int64_t>(last_timestamp);
+        last_bar_timestamp = std::max(last_bar_timestamp, last_timestamp);
     }
+    catch (FXException const& e)
+    {
+        price_update_failure_count[symbol_id] += 1;
+        BOOST_LOG_TRIVIAL(warning) << "OHLC Update Failed " << symbol << "; Number of Failed Loops: " << price_update_failure_count[symbol_id]
+                                   << "Error Message: " << e.what();
+    }
+    // -------------------
+    return true;
 }
 
 std::expected<bool, FXException> FXOrderManagement::pause_till_next_bar()
 {
-    next_bar_timestamp = last_bar_timestamp + update_frequency_seconds;
-
-    std::size_t const time_next_bar_will_be_ready = next_bar_timestamp + update_frequency_seconds;
+    next_bar_timestamp = last_bar_timestamp + static_cast<std::size_t>(update_frequency_seconds);
+    pipeline_response = std::expected<bool, FXException> {true};
+    bars_traded = false;
 
-    std::size_t timestamp_now = (std::chrono::system_clock::now().time_since_epoch()).count() * std::chrono::system_clock::period::num /
-                                std::chrono::system_clock::period::den;
+    // Fixed Mode Fetches One Full Interval After (next_bar_timestamp); Polling Mode Starts Once the Bar Has Typically Been Published
+    std::chrono::system_clock::time_point const next_bar_time {std::chrono::seconds(static_cast<std::int64_t>(next_bar_timestamp))};
+    std::chrono::system_clock::time_point const bar_fetch_time =
+        (bar_ready_polling) ? next_bar_time + first_bar_poll_delay() : next_bar_time + std::chrono::seconds {update_frequency_seconds};
+    // Polling Gives Up One Interval After the Fixed Mode Would Have Fetched; the Final Attempt Counts Failures as Usual
+    bar_poll_deadline = (bar_ready_polling) ? next_bar_time + 2 * std::chrono::seconds {update_frequency_seconds} : bar_fetch_time;
 
     // -----------------------------------
-    // Execute Trading Model & Confirm All Data Acquired Properly
-    while (! price_update_failure_count.empty() && timestamp_now <= time_next_bar_will_be_ready - 20)
+    // Every Symbol's Fetch -> Signal -> Order Pipeline Runs Independently | Finished Requests Wake the Loop & are Traded at Once
+    BOOST_LOG_TRIVIAL(info) << "FX Order Management - Waiting For OHLC Bar Update";
+    bool bar_requested = false;
+    while (! event_loop.shutdown_requested())
     {
-        std::vector<std::string> error_list;
-        for (auto& [symbol, count] : price_update_failure_count)
+        auto const timestamp_now = std::chrono::system_clock::now();
+        if (! bar_requested && timestamp_now >= bar_fetch_time)
         {
-            return_price_history({symbol});
-            if (! execute_list.empty())
+            BOOST_LOG_TRIVIAL(info) << "FX Order Management - Attempting to Fetch Price History";
+            for (fx_symbol_id_t const symbol_id : trading_symbols)
             {
-                auto trade_order_response = trade_order_sequence();
-                if (! trade_order_response)
-                {
-                    return trade_order_response;
-                }
+                awaiting_bar[symbol_id] = true;
+                poll_interval[symbol_id] = BAR_POLL_INITIAL_INTERVAL;
+                next_fetch_time[symbol_id] = timestamp_now;
             }
+            bar_requested = true;
+        }
 
-            if (price_update_failure_count[symbol] > max_retry_failures)
+        bool pipelines_busy = false;
+        auto wake_time = (bar_requested) ? timestamp_now + PRICE_RETRY_INTERVAL : bar_fetch_time;
+        for (fx_symbol_id_t const symbol_id : trading_symbols)
+        {
+            auto const fetch_time = next_fetch_time[symbol_id];
+            // Failed Symbols Retry to Catch Up with the Bar the Others Hold, Until Shortly Before the Next One
+            bool const scheduled = awaiting_bar[symbol_id] || fetch_time + PRICE_RETRY_CUTOFF <= bar_fetch_time;
+            if (! fetch_in_flight[symbol_id] && fetch_time != std::chrono::system_clock::time_point::max() && scheduled)
             {
-                error_list.emplace_back(symbol);
-                fx_symbols_to_trade.erase(remove(fx_symbols_to_trade.begin(), fx_symbols_to_trade.end(), symbol), fx_symbols_to_trade.end());
-                position_multiplier[symbol] = 0;
-
-                BOOST_LOG_TRIVIAL(error) << "Too Many Errors: " << symbol << " Removed from Trading";
+                if (fetch_time <= timestamp_now)
+                {
+                    dispatch_price_request(symbol_id, (awaiting_bar[symbol_id]) ? next_bar_timestamp : last_bar_timestamp);
+                }
+                else
+                {
+                    wake_time = std::min(wake_time, fetch_time);
+                }
             }
+            pipelines_busy = pipelines_busy || fetch_in_flight[symbol_id] || awaiting_bar[symbol_id];
         }
 
-        for (auto const& symbol : error_list) { price_update_failure_count.erase(symbol); }
-
-        sleep(10);
-        timestamp_now = (std::chrono::system_clock::now().time_since_epoch()).count() * std::chrono::system_clock::period::num /
-                        std::chrono::system_clock::period::den;
-    }
-
-    // -----------------------------------
-    // Wait Till New Bar Ready & Fetch OHLC
-    int time_to_wait_now = time_next_bar_will_be_ready - timestamp_now;
-    if (time_to_wait_now > 0)
-    {
-        BOOST_LOG_TRIVIAL(info) << "FX Order Management - Waiting For OHLC Bar Update";
-        sleep(time_to_wait_now);
+        if (bar_requested && ! pipelines_busy)
+        {
+            break;
+        }
+        event_loop.run_once(wake_time);
     }
-    return_price_history(fx_symbols_to_trade);
     // -------------------
-    return std::expected<bool, FXException> {true};
+    return std::move(pipeline_response);
 }
 
-std::expected<bool, FXException> FXOrderManagement::execute_signals(std::vector<nlohmann::json>& trades_map)
+std::chrono::milliseconds FXOrderManagement::first_bar_poll_delay() const
 {
-    if (place_trades || emergency_close)
+    // Earliest Delay Observed Across Symbols, Stepped Back Each Bar so the Estimate Can Also Shrink
+    std::int64_t delay_ms = bar_poll_delay_ms;
+    bool observed = false;
+    std::int64_t earliest_observed_ms = 0;
+    for (fx_symbol_id_t const symbol_id : trading_symbols)
     {
-        ++execution_loop_count;
-        for (auto& trades_json : trades_map)
+        std::int64_t const publication_delay_ms = bar_publication_delay_ms[symbol_id];
+        if (publication_delay_ms >= 0 && (! observed || publication_delay_ms < earliest_observed_ms))
         {
-            std::string symbol = trades_json.begin().key();
-            auto trade_order_response = session.trade_order(trades_json, "MARKET");
-
-            // // ------------
-            // // Notify if any errors
-            // if (! error_list.empty())
-            // {
-            //     for (auto const& elem : error_list) { BOOST_LOG_TRIVIAL(warning) << "Trading Error for: " << elem; }
-            // }
-        }
-
-        auto active_orders_response = monitor_active_orders();
-        // ------------
-        // Recursive Trade Confirmation Can Only Happen A Maximum of (3) Times
-        if (execution_loop_count <= 3)
-        {
-            auto verify_trades_response = verify_trades_opened(trades_map);
-            if (! verify_trades_response)
-            {
-                return verify_trades_response;
-            }
+            earliest_observed_ms = publication_delay_ms;
+            observed = true;
         }
-        else {}
+    }
+    if (observed)
+    {
+        delay_ms = std::max(delay_ms, earliest_observed_ms - BAR_POLL_INITIAL_INTERVAL.count());
     }
     // -------------------
-    return std::expected<bool, FXException> {true};
+    return std::chrono::milliseconds {delay_ms};
 }
 
-std::expected<bool, FXException> FXOrderManagement::monitor_active_orders()
+std::expected<bool, FXException> FXOrderManagement::execute_signals(std::vector<FXOrderIntent>& order_intents)
 {
-    // Allow (5) seconds for market orders to fill
-    sleep(5);
-
-    auto active_orders_response = session.list_active_orders();
-    if (! active_orders_response)
+    if (! place_trades && ! emergency_close)
     {
-        return std::expected<bool, FXException> {std::unexpect, active_orders_response.error().where(), active_orders_response.error().what()};
+        return std::expected<bool, FXException> {true};
     }
-    nlohmann::json active_orders_json = active_orders_response.value()["ActiveOrders"];
+    return order_executor.execute(order_intents, static_cast<std::size_t>(max_concurrent_orders));
+}
 
-    for (auto& order : active_orders_json)
+bool FXOrderManagement::cache_market_id(fx_symbol_id_t symbol_id)
+{
+    // The Trading Thread is the Only Writer, so it Reads the Map Unlocked
+    std::string const& symbol = symbol_table.name(symbol_id);
+    if (session.market_id_map.contains(symbol))
     {
-        int const status = order["TradeOrder"]["StatusId"];
-        // ---------------------------
-        if (status == 1)
-        {
-
-            auto cancel_order_response = session.cancel_order(order["TradeOrder"]["OrderId"]);
+        return true;
+    }
+    std::lock_guard<std::shared_mutex> lock(session_mutex);
+    auto market_id_response = session.get_market_id(symbol);
+    if (! market_id_response)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Market ID Lookup Failed for: " << symbol << " " << market_id_response.error().what();
+        return false;
+    }
+    return session.market_id_map.contains(symbol);
+}
 
-            if (! cancel_order_response)
-            {
-                return std::expected<bool, FXException> {std::unexpect, cancel_order_response.error().where(), cancel_order_response.error().what()};
-            }
+std::expected<bool, FXException> FXOrderManagement::load_open_positions()
+{
+    if (open_positions_current)
+    {
+        return std::expected<bool, FXException> {true};
+    }
 
-            BOOST_LOG_TRIVIAL(warning) << "Canceled Order: " << cancel_order_response.value();
-        }
-        // ---------------------------
-        std::vector<int> MAJOR_STATUS_ERROR_CODES = {6, 8, 10};
-        if (std::find(MAJOR_STATUS_ERROR_CODES.begin(), MAJOR_STATUS_ERROR_CODES.end(), status) != MAJOR_STATUS_ERROR_CODES.end())
-        {
-            return std::expected<bool, FXException> {
-                std::unexpect, std::source_location::current().function_name(), "Major Order Status Error: " + std::to_string(status)};
-        }
+    auto open_positions_response = session.list_open_positions();
+    if (! open_positions_response)
+    {
+        return std::expected<bool, FXException> {std::unexpect, open_positions_response.error().where(), open_positions_response.error().what()};
+    }
+    nlohmann::json& open_positions = open_positions_response.value()["OpenPositions"];
+    if (! open_positions.is_array())
+    {
+        return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(), "JSON Key Error"};
     }
+    open_positions_snapshot = std::move(open_positions);
+    open_positions_current = true;
     // -------------------
     return std::expected<bool, FXException> {true};
 }
 
-std::expected<bool, FXException> FXOrderManagement::verify_trades_opened(std::vector<nlohmann::json>& trades_map)
+void FXOrderManagement::invalidate_open_positions() noexcept { open_positions_current = false; }
+
+nlohmann::json const& FXOrderManagement::open_positions() const noexcept { return open_positions_snapshot; }
+
+bool FXOrderManagement::resolve_market_id(fx_symbol_id_t symbol_id) { return cache_market_id(symbol_id); }
+
+std::expected<nlohmann::json, FXException> FXOrderManagement::trade_order(FXOrderIntent const& intent)
 {
-    auto open_positions_response = session.list_open_positions();
-    if (! open_positions_response)
+    nlohmann::json payload = trade_payload(intent, symbol_table.name(intent.symbol_id));
+    std::shared_lock<std::shared_mutex> session_lock(session_mutex);
+    auto trade_order_response = session.trade_order(payload, "MARKET");
+    if (! trade_order_response)
     {
-        std::expected<bool, FXException> {std::unexpect, open_positions_response.error().where(), open_positions_response.error().what()};
+        return std::expected<nlohmann::json, FXException> {std::unexpect, trade_order_response.error().where(), trade_order_response.error().what()};
     }
-    nlohmann::json open_positions = open_positions_response.value()["OpenPositions"];
+    return std::move(trade_order_response.value());
+}
 
-    for (auto& position : open_positions)
+std::expected<nlohmann::json, FXException> FXOrderManagement::list_active_orders()
+{
+    auto active_orders_response = session.list_active_orders();
+    if (! active_orders_response)
     {
-        std::string const symbol = position["MarketName"];
-        float const existing_quantity = position["Quantity"];
-        std::string const existing_direction = position["Direction"];
-        // ------------
-        int iteration = 0;
-        for (auto& trade_json : trades_map)
-        {
-            std::string key = trade_json.begin().key();
-            if (key == symbol)
-            {
-                int const final_quantity = trade_json[symbol]["Final Quantity"];
-                std::string const direction = trade_json[symbol]["Direction"];
-
-                if (direction != existing_direction)
-                {
-                    trade_json["Quantity"] = existing_quantity + final_quantity;
-                }
-                else if (direction == existing_direction && existing_quantity < final_quantity)
-                {
-                    trade_json["Quantity"] = final_quantity - existing_quantity;
-                }
-                else
-                {
-                    trades_map.erase(trades_map.begin() + iteration);
-                    break;
-                }
-            }
-            ++iteration;
-        }
+        return std::expected<nlohmann::json, FXException> {
+            std::unexpect, active_orders_response.error().where(), active_orders_response.error().what()};
     }
-    // -------------------
-    // Execute Trades
-    if (! trades_map.empty())
+    return std::move(active_orders_response.value());
+}
+
+std::expected<nlohmann::json, FXException> FXOrderManagement::cancel_order(std::int64_t order_id)
+{
+    auto cancel_order_response = session.cancel_order(std::to_string(order_id));
+    if (! cancel_order_response)
     {
-        auto execute_signal_response = execute_signals(trades_map);
-        if (! execute_signal_response)
-        {
-            return execute_signal_response;
-        }
+        return std::expected<nlohmann::json, FXException> {
+            std::unexpect, cancel_order_response.error().where(), cancel_order_response.error().what()};
     }
-    // -------------------
-    return std::expected<bool, FXException> {true};
+    return std::move(cancel_order_response.value());
 }
 
+bool FXOrderManagement::wait_for(std::chrono::milliseconds duration) { return event_loop.wait_for(duration); }
+
 // ==============================================================================================
 // Gain Capital API
 // ==============================================================================================
@@ -586,9 +893,9 @@ std::expected<bool, FXException> FXOrderManagement::gain_capital_session(std::st
 
     BOOST_LOG_TRIVIAL(info) << "FX Order Management - New Gain Capital Session Initiated";
 
-    for (auto const& symbol : fx_symbols_to_trade)
+    for (fx_symbol_id_t const symbol_id : trading_symbols)
     {
-        auto market_id_response = session.get_market_id(symbol);
+        auto market_id_response = session.get_market_id(symbol_table.name(symbol_id));
         if (! market_id_response)
         {
             return std::expected<bool, FXException> {std::unexpect, market_id_response.error().where(), market_id_response.error().what()};
@@ -601,12 +908,46 @@ std::expected<bool, FXException> FXOrderManagement::gain_capital_session(std::st
 // ==============================================================================================
 // FX Trading Model
 // ==============================================================================================
-void FXOrderManagement::initialize_trading_model(std::string const& symbol) noexcept
+fx_symbol_id_t FXOrderManagement::add_symbol(std::string_view symbol)
+{
+    fx_symbol_id_t const symbol_id = symbol_table.intern(symbol);
+    if (symbol_table.size() > trading_models.size())
+    {
+        trading_models.resize(symbol_table.size());
+        execute_set.resize(symbol_table.size(), false);
+        symbol_price_bars.resize(symbol_table.size());
+        position_multiplier.resize(symbol_table.size(), 1);
+        price_update_failure_count.resize(symbol_table.size(), 0);
+        symbol_bar_timestamp.resize(symbol_table.size(), 0);
+        bar_publication_delay_ms.resize(symbol_table.size(), -1);
+        ohlc_requests.resize(symbol_table.size());
+        fetch_in_flight.resize(symbol_table.size(), false);
+        awaiting_bar.resize(symbol_table.size(), false);
+        next_fetch_time.resize(symbol_table.size(), std::chrono::system_clock::time_point::max());
+        poll_interval.resize(symbol_table.size(), BAR_POLL_INITIAL_INTERVAL);
+    }
+    return symbol_id;
+}
+
+std::expected<bool, FXException> FXOrderManagement::initialize_trading_model(fx_symbol_id_t symbol_id)
 {
-    trading_model_map.emplace(symbol,
-        FXTradingModel {open_prices_map[symbol], high_prices_map[symbol], low_prices_map[symbol], close_prices_map[symbol], datetime_map[symbol]});
+    if (trading_models[symbol_id])
+    {
+        return std::expected<bool, FXException> {true};
+    }
+
+    std::string const& symbol = symbol_table.name(symbol_id);
+    FXModelConfig const& config = (model_config_map.contains(symbol)) ? model_config_map.at(symbol) : default_model_config;
+    auto trading_model_response = FXTradingModelRegistry::instance().create(config.model_name, config.parameters);
+    if (! trading_model_response)
+    {
+        return std::expected<bool, FXException> {std::unexpect, std::move(trading_model_response.error())};
+    }
+    trading_models[symbol_id] = std::move(trading_model_response.value());
 
-    BOOST_LOG_TRIVIAL(info) << "FX Order Management - Trading Model Initialized for " << symbol;
+    BOOST_LOG_TRIVIAL(info) << "FX Order Management - Trading Model Initialized for " << symbol << " (" << config.model_name << ")";
+    // -------------------
+    return std::expected<bool, FXException> {true};
 }
 
 // ==============================================================================================
@@ -723,6 +1064,93 @@ std::expected<bool, FXException> FXOrderManagement::load_user_settings()
             return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
                 "Key 'End_Hour_London_Exchange' must be a number in user_settings.json."};
         }
+
+        // Optional Settings
+        if (data.contains("Incremental_Update"))
+        {
+            if (! data["Incremental_Update"].is_boolean())
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Incremental_Update' must be a boolean in user_settings.json."};
+            }
+            incremental_update = data["Incremental_Update"];
+        }
+
+        if (data.contains("Max_Concurrent_Requests"))
+        {
+            if (! data["Max_Concurrent_Requests"].is_number_integer() || data["Max_Concurrent_Requests"] < 1)
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Max_Concurrent_Requests' must be a positive integer in user_settings.json."};
+            }
+            max_concurrent_requests = data["Max_Concurrent_Requests"];
+        }
+
+        if (data.contains("Max_Concurrent_Orders"))
+        {
+            if (! data["Max_Concurrent_Orders"].is_number_integer() || data["Max_Concurrent_Orders"] < 1)
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Max_Concurrent_Orders' must be a positive integer in user_settings.json."};
+            }
+            max_concurrent_orders = data["Max_Concurrent_Orders"];
+        }
+
+        if (data.contains("Bar_Ready_Polling"))
+        {
+            if (! data["Bar_Ready_Polling"].is_boolean())
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Bar_Ready_Polling' must be a boolean in user_settings.json."};
+            }
+            bar_ready_polling = data["Bar_Ready_Polling"];
+        }
+
+        if (data.contains("Bar_Poll_Delay_Ms"))
+        {
+            if (! data["Bar_Poll_Delay_Ms"].is_number_integer() || data["Bar_Poll_Delay_Ms"] < 0)
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Bar_Poll_Delay_Ms' must be a non-negative integer in user_settings.json."};
+            }
+            bar_poll_delay_ms = data["Bar_Poll_Delay_Ms"];
+        }
+
+        if (data.contains("Verify_Streaming_Indicators"))
+        {
+            if (! data["Verify_Streaming_Indicators"].is_boolean())
+            {
+                return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Key 'Verify_Streaming_Indicators' must be a boolean in user_settings.json."};
+            }
+            verify_streaming_indicators = data["Verify_Streaming_Indicators"];
+        }
+
+        if (data.contains("Trading_Models"))
+        {
+            if (! data["Trading_Models"].is_object())
+            {
+                return std::expected<bool, FXException> {
+                    std::unexpect, std::source_location::current().function_name(), "Key 'Trading_Models' must be an object in user_settings.json."};
+            }
+            for (auto const& [key, value] : data["Trading_Models"].items())
+            {
+                FXModelConfig config;
+                if (! parse_model_config(value, config))
+                {
+                    return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+                        "Invalid Trading Model for '" + key + "' in user_settings.json. Registered Models Must Be Used."};
+                }
+                if (key == "Default")
+                {
+                    default_model_config = config;
+                }
+                else
+                {
+                    model_config_map[key] = config;
+                }
+            }
+        }
     }
     else
     {
@@ -755,28 +1183,43 @@ std::expected<bool, FXException> FXOrderManagement::build_filesystem_directory(s
     return std::expected<bool, FXException> {true};
 }
 
-std::expected<bool, FXException> FXOrderManagement::read_active_management_file()
+std::string FXOrderManagement::interface_directory() const
 {
-    std::string dir;
-    if (! fx_order_mgmt_testing)
+    return sys_path + ((fx_order_mgmt_testing) ? fx_mgmt_test_dir : "/interface_files");
+}
+
+std::expected<bool, FXException> FXOrderManagement::update_active_management()
+{
+    if (! active_management_watcher.is_watching())
     {
-        dir = sys_path + "/interface_files";
+        std::string const dir = interface_directory();
+        auto build_directory_response = build_filesystem_directory(dir);
+        if (! build_directory_response)
+        {
+            return build_directory_response;
+        }
+        auto watch_response = active_management_watcher.watch(dir + "/active_order_management.json");
+        if (! watch_response)
+        {
+            return watch_response;
+        }
+        active_management_loaded = false;
     }
-    else
+    if (active_management_loaded && ! active_management_watcher.changed())
     {
-        dir = sys_path + fx_mgmt_test_dir;
+        return std::expected<bool, FXException> {true};
     }
-    std::string const file_name = dir + "/active_order_management.json";
     // -------------------
-    auto build_directory_response = build_filesystem_directory(dir);
-    if (! build_directory_response)
-    {
-        return build_directory_response;
-    }
+    return read_active_management_file();
+}
+
+std::expected<bool, FXException> FXOrderManagement::read_active_management_file()
+{
+    std::string const file_name = interface_directory() + "/active_order_management.json";
 
     nlohmann::json data;
-    std::vector<std::string> copy_of_fx_symbols = fx_symbols_to_trade;
-    std::vector<std::string> emergency_close_list;
+    std::vector<fx_symbol_id_t> unlisted_symbols = trading_symbols;
+    std::vector<fx_symbol_id_t> close_requests;
 
     std::ifstream in(file_name);
     if (in.is_open())
@@ -798,55 +1241,224 @@ std::expected<bool, FXException> FXOrderManagement::read_active_management_file(
 
         for (nlohmann::json::iterator it = data.begin(); it != data.end(); ++it)
         {
-            std::string symbol = it.key();
-            nlohmann::json json_value = it.value();
+            fx_symbol_id_t const symbol_id = add_symbol(it.key());
+            nlohmann::json const& json_value = it.value();
+            int const previous_multiplier = position_multiplier[symbol_id];
 
-            if (json_value.contains("Close Position") && json_value["Close Position"].is_boolean())
+            if (json_value.contains("Position_Size_Multiple") && json_value["Position_Size_Multiple"].is_number())
             {
-                if (json_value["Close Position"])
-                {
-                    emergency_close_list.push_back(symbol);
-                    position_multiplier[symbol] = 0;
-                }
+                position_multiplier[symbol_id] = json_value["Position_Size_Multiple"];
             }
             else {}
 
-            if (json_value.contains("Position_Size_Multiple") && json_value["Position_Size_Multiple"].is_number())
+            // "Close Position" is the Key Written by Earlier Versions
+            for (char const* close_key : {"Close_Position", "Close Position"})
             {
-                position_multiplier[symbol] = json_value["Position_Size_Multiple"];
+                if (json_value.contains(close_key) && json_value[close_key].is_boolean() && json_value[close_key])
+                {
+                    position_multiplier[symbol_id] = 0;
+                    if (previous_multiplier != 0)
+                    {
+                        close_requests.push_back(symbol_id);
+                    }
+                    break;
+                }
             }
-            else {}
-            copy_of_fx_symbols.erase(remove(copy_of_fx_symbols.begin(), copy_of_fx_symbols.end(), symbol), copy_of_fx_symbols.end());
+            unlisted_symbols.erase(remove(unlisted_symbols.begin(), unlisted_symbols.end(), symbol_id), unlisted_symbols.end());
         }
     }
+    active_management_loaded = true;
 
-    // Add
-    for (std::string const& symbol : copy_of_fx_symbols) { data[symbol] = {{"Close Position", false}, {"Position_Size_Multiple", 1}}; }
-
-    std::ofstream out(file_name);
-    if (out.is_open())
+    // Add | The File is Only Written When Symbols are Missing
+    if (! unlisted_symbols.empty())
     {
-        out << data.dump(4);
-        bool success = out.good();
-        out.close();
-        if (! success)
+        for (fx_symbol_id_t const symbol_id : unlisted_symbols)
         {
-            return std::expected<bool, FXException> {
-                std::unexpect, std::source_location::current().function_name(), "Active Management File Failed to Write Data"};
+            data[symbol_table.name(symbol_id)] = {{"Close_Position", false}, {"Position_Size_Multiple", 1}};
+        }
+
+        auto write_response = write_active_management_file(data);
+        if (! write_response)
+        {
+            return write_response;
         }
     }
-    else
+    // -------------------
+    if (! close_requests.empty())
+    {
+        return close_positions(close_requests);
+    }
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXOrderManagement::write_active_management_file(nlohmann::json const& data)
+{
+    std::string const file_name = interface_directory() + "/active_order_management.json";
+
+    // Replaced by Rename so an Operator's Editor Never Reads a Partial File
+    std::string const temporary_file = file_name + ".tmp";
+    std::ofstream out(temporary_file);
+    if (! out.is_open())
     {
         return std::expected<bool, FXException> {
             std::unexpect, std::source_location::current().function_name(), "Active Management File Failed to Open"};
     }
+    out << data.dump(4);
+    out.close();
+    std::error_code rename_error;
+    if (out)
+    {
+        std::filesystem::rename(temporary_file, file_name, rename_error);
+    }
+    if (! out || rename_error)
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Active Management File Failed to Write Data"};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXOrderManagement::record_close_requests(std::vector<fx_symbol_id_t> const& symbol_ids)
+{
+    std::string const file_name = interface_directory() + "/active_order_management.json";
+
+    nlohmann::json data = nlohmann::json::object();
+    std::ifstream in(file_name);
+    if (in.is_open())
+    {
+        try
+        {
+            data = nlohmann::json::parse(in);
+        }
+        catch (nlohmann::json::exception const& e)
+        {
+            return std::expected<bool, FXException> {
+                std::unexpect, std::source_location::current().function_name(), "Failed to Parse JSON: " + std::string(e.what())};
+        }
+        in.close();
+    }
+    for (fx_symbol_id_t const symbol_id : symbol_ids)
+    {
+        nlohmann::json& entry = data[symbol_table.name(symbol_id)];
+        entry["Close_Position"] = true;
+        if (! entry.contains("Position_Size_Multiple"))
+        {
+            entry["Position_Size_Multiple"] = 1;
+        }
+    }
+    // -------------------
+    return write_active_management_file(data);
+}
+
+std::expected<bool, FXException> FXOrderManagement::close_positions(std::vector<fx_symbol_id_t> const& symbol_ids, bool all_symbols)
+{
+    // Requests Arrive Mid-Bar, so the Cycle's Snapshot May Be Stale
+    invalidate_open_positions();
+    auto open_positions_response = load_open_positions();
+    if (! open_positions_response)
+    {
+        return open_positions_response;
+    }
+
+    std::vector<FXOrderIntent> order_intents = build_exit_trades(symbol_ids, all_symbols);
+    for (FXOrderIntent const& intent : order_intents)
+    {
+        BOOST_LOG_TRIVIAL(info) << "Closing Position on Request: " << symbol_table.name(intent.symbol_id);
+    }
+    // -------------------
+    if (order_intents.empty())
+    {
+        return std::expected<bool, FXException> {true};
+    }
+    return execute_signals(order_intents);
+}
+
+std::expected<bool, FXException> FXOrderManagement::handle_control_commands()
+{
+    auto const is_managed_symbol = [this](std::string_view symbol) { return symbol_table.find(symbol).has_value(); };
+    for (FXControlCommand const& command : control_channel.receive(is_managed_symbol))
+    {
+        std::vector<fx_symbol_id_t> symbol_ids;
+        if (command.close_all)
+        {
+            // Same as Restarting with Emergency Close | Exit Only Until Restarted
+            emergency_close = true;
+            BOOST_LOG_TRIVIAL(warning) << "Control Channel - Closing All Positions";
+        }
+        for (std::string const& symbol : command.symbols)
+        {
+            fx_symbol_id_t const symbol_id = *symbol_table.find(symbol);
+            position_multiplier[symbol_id] = 0;
+            symbol_ids.push_back(symbol_id);
+            BOOST_LOG_TRIVIAL(warning) << "Control Channel - Closing " << symbol;
+        }
+        // The Active Management File Would Otherwise Restore the Multiple on its Next Reload
+        if (! symbol_ids.empty())
+        {
+            auto record_response = record_close_requests(symbol_ids);
+            if (! record_response)
+            {
+                BOOST_LOG_TRIVIAL(warning) << "Control Channel - Close Not Recorded in Active Management File: " << record_response.error().what();
+            }
+        }
+
+        auto close_positions_response = close_positions(symbol_ids, command.close_all);
+        if (! close_positions_response)
+        {
+            return close_positions_response;
+        }
+    }
     // -------------------
     return std::expected<bool, FXException> {true};
 }
 
 std::expected<bool, FXException> FXOrderManagement::output_profit_report()
 {
-    nlohmann::json current_performance = {}, current_positions = {};
+    // Collect Position Data
+    auto open_positions_response = load_open_positions();
+    if (! open_positions_response)
+    {
+        return open_positions_response;
+    }
+
+    std::int64_t const timestamp_now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    FXReportSnapshot snapshot;
+    for (auto const& position : open_positions_snapshot)
+    {
+        fx_symbol_id_t const symbol_id = add_symbol(position["MarketName"].get_ref<std::string const&>());
+        FXReportPosition report_position {
+            symbol_table.name(symbol_id), position["Direction"], position["Quantity"], position["Price"], std::nullopt};
+
+        // Close of a Bar Finished Within the Last Update Interval, Otherwise Requested by the Worker
+        FXBarSeries const& price_bars = symbol_price_bars[symbol_id];
+        if (price_bars.size() && timestamp_now < price_bars.date_time().back() + 2 * update_frequency_seconds)
+        {
+            report_position.current_price = price_bars.close().back();
+        }
+        else
+        {
+            cache_market_id(symbol_id);
+        }
+        snapshot.positions.push_back(std::move(report_position));
+    }
+    time_t time_now = time(NULL);
+    snapshot.last_updated = ctime(&time_now);
+    snapshot.file_name = sys_path + "/interface_files/reports/FX_Management_Report_" + fx_utilities.get_todays_date() + ".json";
+    // -------------------
+    if (! report_worker)
+    {
+        return write_profit_report(snapshot);
+    }
+    report_worker->submit(std::move(snapshot));
+    return std::expected<bool, FXException> {true};
+}
+
+std::expected<bool, FXException> FXOrderManagement::write_profit_report(FXReportSnapshot const& snapshot)
+{
+    // Runs on the Report Worker While the Trading Thread May Cache Market IDs
+    std::shared_lock<std::shared_mutex> session_lock(session_mutex);
 
     // Collect Margin Information
     auto margin_info_response = session.get_margin_info();
@@ -858,7 +1470,7 @@ std::expected<bool, FXException> FXOrderManagement::output_profit_report()
 
     nlohmann::json margin_json = margin_info_response.value();
 
-    float equity_total = 0, margin_total = 0;
+    double equity_total = 0, margin_total = 0;
     if (margin_json.contains("netEquity") && margin_json["netEquity"].is_number())
     {
         equity_total = margin_json["netEquity"];
@@ -879,43 +1491,56 @@ std::expected<bool, FXException> FXOrderManagement::output_profit_report()
         BOOST_LOG_TRIVIAL(warning) << "'Margin' is not present in margin info. Profit Report will be invalid.";
     }
 
-    // Collect Position Data
-    auto open_positions_response = session.list_open_positions();
-    if (! open_positions_response)
+    // Request Prices Missing from the Snapshot | A Market ID Not Yet Cached Would be Looked Up, Writing the Client
+    std::vector<std::size_t> price_requests;
+    for (std::size_t x = 0; x < snapshot.positions.size(); ++x)
     {
-        std::expected<bool, FXException> {std::unexpect, open_positions_response.error().where(), open_positions_response.error().what()};
+        if (! snapshot.positions[x].current_price && session.market_id_map.contains(snapshot.positions[x].symbol))
+        {
+            price_requests.push_back(x);
+        }
     }
 
-    nlohmann::json open_positions = open_positions_response.value()["OpenPositions"];
-    for (auto& position : open_positions)
-    {
-        std::string const market_name = position["MarketName"];
-        int const direction = (position["Direction"] == "buy") ? 1 : -1;
-        float const entry_price = position["Price"];
-        int const quantity = position["Quantity"];
+    std::vector<std::expected<nlohmann::json, gaincapital::GCException>> responses(price_requests.size());
+    FXTaskPool::parallel_for(price_requests.size(), static_cast<std::size_t>(max_concurrent_requests),
+        [&](std::size_t x) { responses[x] = session.get_prices(snapshot.positions[price_requests[x]].symbol); });
 
-        float current_price = 0;
-        auto prices_response = session.get_prices({market_name});
-        if (! prices_response)
+    std::vector<std::optional<double>> current_prices(snapshot.positions.size());
+    for (std::size_t x = 0; x < snapshot.positions.size(); ++x) { current_prices[x] = snapshot.positions[x].current_price; }
+    for (std::size_t x = 0; x < price_requests.size(); ++x)
+    {
+        if (! responses[x])
         {
-            return std::expected<bool, FXException> {std::unexpect, prices_response.error().where(), prices_response.error().what()};
+            return std::expected<bool, FXException> {std::unexpect, responses[x].error().where(), responses[x].error().what()};
         }
-
-        nlohmann::json prices_json = prices_response.value();
-        if (prices_json["PriceTicks"][0]["Price"].dump() != "null" && prices_json["PriceTicks"][0]["Price"].is_number())
+        nlohmann::json const& prices_json = responses[x].value();
+        if (prices_json.contains("PriceTicks") && prices_json["PriceTicks"].is_array() && ! prices_json["PriceTicks"].empty() &&
+            prices_json["PriceTicks"][0].contains("Price") && prices_json["PriceTicks"][0]["Price"].is_number())
         {
-            float current_price = prices_json["PriceTicks"][0]["Price"];
+            current_prices[price_requests[x]] = prices_json["PriceTicks"][0]["Price"].get<double>();
         }
-        else
+    }
+    // -------------------
+    // Reuses the Previous Report's Storage
+    profit_report.positions.resize(snapshot.positions.size());
+    for (std::size_t x = 0; x < snapshot.positions.size(); ++x)
+    {
+        FXReportPosition const& position = snapshot.positions[x];
+        FXPositionPerformance& performance = profit_report.positions[x];
+        int const direction = (position.direction == "buy") ? 1 : -1;
+
+        if (! current_prices[x])
         {
-            BOOST_LOG_TRIVIAL(warning) << "'Current Price' is not present in price request. " << market_name << " will be invalid.";
+            BOOST_LOG_TRIVIAL(warning) << "'Current Price' is not present in price request. " << position.symbol << " will be invalid.";
         }
 
-        float profit = round((current_price - entry_price) * 100'000) / 100'000 * direction;
-        float profit_percent = (entry_price != 0) ? round(profit * 10'000 / entry_price) / 100 : 0;
-
-        current_positions[market_name] = {{"Direction", position["Direction"]}, {"Quantity", position["Quantity"]},
-            {"Entry Price", position["Price"]}, {"Current Price", current_price}, {"Profit", profit}, {"Profit Percent", profit_percent}};
+        performance.symbol = position.symbol;
+        performance.direction = position.direction;
+        performance.quantity = position.quantity;
+        performance.entry_price = position.entry_price;
+        performance.current_price = current_prices[x].value_or(0);
+        performance.profit = round((performance.current_price - position.entry_price) * 100'000) / 100'000 * direction;
+        performance.profit_percent = (position.entry_price != 0) ? round(performance.profit * 10'000 / position.entry_price) / 100 : 0;
     }
     // -------------------
     // Collect Totals Data
@@ -923,41 +1548,25 @@ std::expected<bool, FXException> FXOrderManagement::output_profit_report()
     {
         initial_equity = equity_total;
     }
-    float const total_profit = round((equity_total - initial_equity) * 100) / 100;
-    float const total_profit_percent = (initial_equity != 0) ? round(total_profit * 10'000 / initial_equity) / 100 : 0;
-
-    current_performance["Performance Information"] = {{"Initial Funds", initial_equity}, {"Current Funds", equity_total},
-        {"Margin Utilized", margin_total}, {"Profit Cumulative", total_profit}, {"Profit Percent Cumulative", total_profit_percent}};
-    current_performance["Position Information"] = current_positions;
-    time_t time_now = time(NULL);
-    current_performance["Last Updated"] = ctime(&time_now);
+    profit_report.initial_funds = initial_equity;
+    profit_report.current_funds = equity_total;
+    profit_report.margin_utilized = margin_total;
+    profit_report.profit_cumulative = round((equity_total - initial_equity) * 100) / 100;
+    profit_report.profit_percent_cumulative = (initial_equity != 0) ? round(profit_report.profit_cumulative * 10'000 / initial_equity) / 100 : 0;
+    profit_report.last_updated = snapshot.last_updated;
 
     // Build Directory
-    std::string const dir = sys_path + "/interface_files/reports";
-    std::string const file_name = dir + "/FX_Management_Report_" + fx_utilities.get_todays_date() + ".json";
-    // -------------------
-    auto build_directory_response = build_filesystem_directory(dir);
+    auto build_directory_response = build_filesystem_directory(std::filesystem::path(snapshot.file_name).parent_path().string());
     if (! build_directory_response)
     {
         return build_directory_response;
     }
 
-    // Output Data to File
-    std::ofstream out(file_name);
-    if (out.is_open())
-    {
-        out << current_performance.dump(4);
-        bool success = out.good();
-        out.close();
-        if (! success)
-        {
-            return std::expected<bool, FXException> {
-                std::unexpect, std::source_location::current().function_name(), "Profit Report File Failed to Write Data"};
-        }
-    }
-    else
+    // Output Data to File | Skipped When Nothing but the Timestamp Changed
+    auto report_writer_response = report_writer.write(snapshot.file_name, profit_report);
+    if (! report_writer_response)
     {
-        return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(), "Profit Report File Failed to Open"};
+        return std::expected<bool, FXException> {std::unexpect, std::move(report_writer_response.error())};
     }
     // -------------------
     return std::expected<bool, FXException> {true};
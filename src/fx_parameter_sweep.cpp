@@ -0,0 +1,327 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_parameter_sweep.h"
+
+#include <ctype.h>// for toupper
+
+#include <algorithm>      // for sort, find, min, transform
+#include <charconv>       // for from_chars
+#include <cstddef>        // for size_t
+#include <cstdint>        // for int64_t
+#include <expected>       // for expected
+#include <filesystem>     // for create_directories, path
+#include <fstream>        // for basic_ofstream
+#include <limits>         // for numeric_limits
+#include <optional>       // for optional
+#include <source_location>// for current, function_name...
+#include <sstream>        // for basic_ostringstream
+#include <string>         // for string, to_string
+#include <string_view>    // for string_view
+#include <system_error>   // for errc, error_code
+#include <utility>        // for move, pair
+#include <vector>         // for vector
+
+#include "fx_backtester.h"             // for FXBacktester, FXBarHistory, FXBacktestConfig
+#include "fx_exception.h"              // for FXException
+#include "fx_task_pool.h"              // for FXTaskPool
+#include "fx_trading_model_interface.h"// for FXModelParameters
+#include "fx_utilities.h"              // for FXUtilities
+
+namespace
+{
+
+std::vector<std::string_view> split(std::string_view text, char delimiter)
+{
+    std::vector<std::string_view> parts;
+    while (! text.empty())
+    {
+        std::size_t const position = text.find(delimiter);
+        parts.push_back(text.substr(0, position));
+        text = (position == std::string_view::npos) ? std::string_view {} : text.substr(position + 1);
+    }
+    return parts;
+}
+
+std::optional<double> parse_number(std::string_view text) noexcept
+{
+    double value = 0;
+    auto const [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc {} || end != text.data() + text.size())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+// Smallest Gap Between Consecutive Bars, i.e. the Source Resolution
+std::int64_t bar_spacing(fxordermgmt::FXBarHistory const& history) noexcept
+{
+    std::int64_t spacing = std::numeric_limits<std::int64_t>::max();
+    for (std::size_t x = 1; x < history.size(); ++x) { spacing = std::min(spacing, history.date_time[x] - history.date_time[x - 1]); }
+    return spacing;
+}
+
+std::int64_t bucket_start(std::int64_t date_time, std::int64_t span_seconds) noexcept
+{
+    std::int64_t const remainder = date_time % span_seconds;
+    return date_time - ((remainder < 0) ? remainder + span_seconds : remainder);
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+std::expected<std::vector<FXModelParameters>, FXException> FXParameterSweep::parse_parameter_grid(std::string_view grid)
+{
+    auto grid_error = [](std::string_view entry) {
+        return std::expected<std::vector<FXModelParameters>, FXException> {std::unexpect, std::source_location::current().function_name(),
+            "Invalid Parameter Grid Entry '" + std::string(entry) + "'; Use Key=1|2|3 or Key=start:stop:step"};
+    };
+
+    std::vector<FXModelParameters> combinations(1);
+    for (std::string_view const entry : split(grid, ','))
+    {
+        std::size_t const equals = entry.find('=');
+        if (equals == std::string_view::npos || ! equals)
+        {
+            return grid_error(entry);
+        }
+        std::string const key {entry.substr(0, equals)};
+        std::string_view const values_text = entry.substr(equals + 1);
+
+        std::vector<double> values;
+        if (values_text.find(':') != std::string_view::npos)
+        {
+            std::vector<std::string_view> const range = split(values_text, ':');
+            auto const start = (range.size() == 3) ? parse_number(range[0]) : std::nullopt;
+            auto const stop = (range.size() == 3) ? parse_number(range[1]) : std::nullopt;
+            auto const step = (range.size() == 3) ? parse_number(range[2]) : std::nullopt;
+            if (! start || ! stop || ! step || *step <= 0 || *stop < *start)
+            {
+                return grid_error(entry);
+            }
+            // Tolerance Keeps the Stop Value Despite Rounding in Fractional Steps
+            for (double x = 0; *start + x * *step <= *stop + *step * 1e-9; ++x) { values.push_back(*start + x * *step); }
+        }
+        else
+        {
+            for (std::string_view const value_text : split(values_text, '|'))
+            {
+                auto const value = parse_number(value_text);
+                if (! value)
+                {
+                    return grid_error(entry);
+                }
+                values.push_back(*value);
+            }
+        }
+        if (values.empty())
+        {
+            return grid_error(entry);
+        }
+        // ------------
+        std::vector<FXModelParameters> expanded;
+        expanded.reserve(combinations.size() * values.size());
+        for (FXModelParameters const& combination : combinations)
+        {
+            for (double const value : values)
+            {
+                expanded.push_back(combination);
+                expanded.back()[key] = value;
+            }
+        }
+        combinations = std::move(expanded);
+    }
+    // -------------------
+    return std::expected<std::vector<FXModelParameters>, FXException> {std::move(combinations)};
+}
+
+std::expected<std::vector<FXSweepSpan>, FXException> FXParameterSweep::parse_spans(std::string_view spans)
+{
+    std::vector<FXSweepSpan> parsed;
+    std::string upper {spans};
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    if (upper == "ALL")
+    {
+        for (int const span : FXUtilities::SPAN_M) { parsed.push_back(FXSweepSpan {"MINUTE", span, 60 * span}); }
+        for (int const span : FXUtilities::SPAN_H) { parsed.push_back(FXSweepSpan {"HOUR", span, 3600 * span}); }
+        return std::expected<std::vector<FXSweepSpan>, FXException> {std::move(parsed)};
+    }
+
+    for (std::string_view const group : split(upper, ';'))
+    {
+        std::size_t const colon = group.find(':');
+        std::string_view const interval = group.substr(0, colon);
+        if (colon == std::string_view::npos || (interval != "MINUTE" && interval != "HOUR"))
+        {
+            return std::expected<std::vector<FXSweepSpan>, FXException> {std::unexpect, std::source_location::current().function_name(),
+                "Invalid Span Group '" + std::string(group) + "'; Use MINUTE:1,5;HOUR:1 or ALL"};
+        }
+        for (std::string_view const span_text : split(group.substr(colon + 1), ','))
+        {
+            auto const span = parse_number(span_text);
+            bool const is_minute = interval == "MINUTE";
+            auto const supported = [&](auto const& span_list) { return std::find(span_list.begin(), span_list.end(), *span) != span_list.end(); };
+            bool const valid = span && (is_minute ? supported(FXUtilities::SPAN_M) : supported(FXUtilities::SPAN_H));
+            if (! valid)
+            {
+                return std::expected<std::vector<FXSweepSpan>, FXException> {std::unexpect, std::source_location::current().function_name(),
+                    "Span Error - " + std::string(interval) + " Span '" + std::string(span_text) + "' is Not Supported"};
+            }
+            int const update_span = static_cast<int>(*span);
+            parsed.push_back(FXSweepSpan {std::string(interval), update_span, (is_minute ? 60 : 3600) * update_span});
+        }
+    }
+    // -------------------
+    return std::expected<std::vector<FXSweepSpan>, FXException> {std::move(parsed)};
+}
+
+std::expected<FXBarHistory, FXException> FXParameterSweep::resample(FXBarHistory const& history, int span_seconds)
+{
+    std::int64_t const spacing = bar_spacing(history);
+    if (span_seconds <= 0 || (history.size() > 1 && (span_seconds < spacing || span_seconds % spacing)))
+    {
+        return std::expected<FXBarHistory, FXException> {std::unexpect, std::source_location::current().function_name(),
+            "Cannot Resample " + std::to_string(spacing) + " Second Bars to " + std::to_string(span_seconds) + " Seconds"};
+    }
+
+    FXBarHistory resampled;
+    std::size_t const estimated_bars = history.size() * static_cast<std::size_t>(std::min<std::int64_t>(spacing, span_seconds)) /
+                                           static_cast<std::size_t>(span_seconds) + 1;
+    resampled.date_time.reserve(estimated_bars);
+    resampled.open.reserve(estimated_bars);
+    resampled.high.reserve(estimated_bars);
+    resampled.low.reserve(estimated_bars);
+    resampled.close.reserve(estimated_bars);
+
+    for (std::size_t x = 0; x < history.size(); ++x)
+    {
+        std::int64_t const bucket = bucket_start(history.date_time[x], span_seconds);
+        if (resampled.date_time.empty() || resampled.date_time.back() != bucket)
+        {
+            resampled.date_time.push_back(bucket);
+            resampled.open.push_back(history.open[x]);
+            resampled.high.push_back(history.high[x]);
+            resampled.low.push_back(history.low[x]);
+            resampled.close.push_back(history.close[x]);
+            continue;
+        }
+        resampled.high.back() = std::max(resampled.high.back(), history.high[x]);
+        resampled.low.back() = std::min(resampled.low.back(), history.low[x]);
+        resampled.close.back() = history.close[x];
+    }
+    // -------------------
+    return std::expected<FXBarHistory, FXException> {std::move(resampled)};
+}
+
+std::expected<FXSweepSummary, FXException> FXParameterSweep::run(std::vector<std::string> const& symbols, std::vector<FXBarHistory> const& histories,
+    std::vector<FXSweepSpan> const& spans, std::vector<FXModelParameters> const& grid, FXBacktestConfig const& base_config,
+    std::size_t max_concurrency)
+{
+    if (symbols.size() != histories.size() || spans.empty() || grid.empty())
+    {
+        return std::expected<FXSweepSummary, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Sweep Requires Bars for Every Symbol, a Span & a Parameter Set"};
+    }
+
+    // Shared Read-Only Bar Data | Each (symbol, span) is Resampled Once; the Source Resolution is Not Copied
+    std::size_t const span_count = spans.size(), grid_count = grid.size();
+    std::vector<std::expected<FXBarHistory, FXException>> resampled(symbols.size() * span_count);
+    std::vector<FXBarHistory const*> bar_data(symbols.size() * span_count, nullptr);
+    FXTaskPool::parallel_for(bar_data.size(), max_concurrency, [&](std::size_t x) {
+        FXBarHistory const& history = histories[x / span_count];
+        int const span_seconds = spans[x % span_count].span_seconds;
+        if (history.size() > 1 && bar_spacing(history) == span_seconds)
+        {
+            bar_data[x] = &history;
+            return;
+        }
+        resampled[x] = resample(history, span_seconds);
+        bar_data[x] = (resampled[x]) ? &resampled[x].value() : nullptr;
+    });
+
+    // Symbol Major Job Order so Work Stealing Keeps a Symbol's Bars on One Worker
+    std::vector<std::expected<FXBacktestResult, FXException>> responses(bar_data.size() * grid_count);
+    FXTaskPool::work_stealing_for(responses.size(), max_concurrency, [&](std::size_t job) {
+        std::size_t const data_index = job / grid_count;
+        if (! bar_data[data_index])
+        {
+            responses[job] = std::expected<FXBacktestResult, FXException> {std::unexpect, resampled[data_index].error()};
+            return;
+        }
+        FXBacktestConfig config = base_config;
+        for (auto const& [key, value] : grid[job % grid_count]) { config.model_config.parameters[key] = value; }
+        responses[job] = FXBacktester::run(symbols[data_index / span_count], *bar_data[data_index], config);
+    });
+    // -------------------
+    FXSweepSummary summary;
+    summary.results.reserve(responses.size());
+    for (std::size_t job = 0; job < responses.size(); ++job)
+    {
+        if (! responses[job])
+        {
+            if (! summary.skipped_jobs++)
+            {
+                summary.first_skip_reason = responses[job].error().what();
+            }
+            continue;
+        }
+        FXSweepResult sweep_result {spans[(job / grid_count) % span_count], grid[job % grid_count], std::move(responses[job].value())};
+        sweep_result.total_profit = sweep_result.result.realized_profit + sweep_result.result.unrealized_profit;
+        summary.results.push_back(std::move(sweep_result));
+    }
+    std::sort(summary.results.begin(), summary.results.end(), [](FXSweepResult const& a, FXSweepResult const& b) {
+        // Higher Profit First; Equal Profit Falls Back to the Smaller Drawdown
+        return a.total_profit > b.total_profit || (! (b.total_profit > a.total_profit) && a.result.max_drawdown < b.result.max_drawdown);
+    });
+    return std::expected<FXSweepSummary, FXException> {std::move(summary)};
+}
+
+std::string FXParameterSweep::format_parameters(FXModelParameters const& parameters)
+{
+    std::vector<std::pair<std::string, double>> sorted {parameters.begin(), parameters.end()};
+    std::sort(sorted.begin(), sorted.end());
+
+    std::ostringstream text;
+    for (std::size_t x = 0; x < sorted.size(); ++x) { text << ((x) ? " " : "") << sorted[x].first << '=' << sorted[x].second; }
+    return text.str();
+}
+
+std::expected<bool, FXException> FXParameterSweep::write_results_table(std::string const& file_name, FXSweepSummary const& summary)
+{
+    std::error_code error;
+    std::filesystem::path const parent = std::filesystem::path(file_name).parent_path();
+    if (! parent.empty())
+    {
+        std::filesystem::create_directories(parent, error);
+    }
+
+    std::ofstream out(file_name);
+    if (! out.is_open())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Sweep Results File Failed to Open: " + file_name};
+    }
+    out << "Rank,Symbol,Update_Interval,Update_Span,Parameters,Profit,Realized Profit,Max Drawdown,Orders,Closed Trades,Winning Trades,"
+           "Bars Evaluated\n";
+    for (std::size_t x = 0; x < summary.results.size(); ++x)
+    {
+        FXSweepResult const& row = summary.results[x];
+        out << x + 1 << ',' << row.result.symbol << ',' << row.span.update_interval << ',' << row.span.update_span << ','
+            << format_parameters(row.parameters) << ',' << row.total_profit << ',' << row.result.realized_profit << ',' << row.result.max_drawdown
+            << ',' << row.result.order_count << ',' << row.result.closed_trades << ',' << row.result.winning_trades << ','
+            << row.result.bars_evaluated << '\n';
+    }
+    if (! out.good())
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Sweep Results File Failed to Write Data"};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+}// namespace fxordermgmt
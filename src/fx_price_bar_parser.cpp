@@ -0,0 +1,118 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_price_bar_parser.h"
+
+#include <charconv>       // for from_chars
+#include <cstddef>        // for size_t
+#include <cstdint>        // for int64_t
+#include <expected>       // for expected
+#include <optional>       // for optional
+#include <source_location>// for current, function_name...
+#include <string>         // for basic_string, to_string
+#include <string_view>    // for string_view
+#include <system_error>   // for errc
+
+#include "json/json.hpp"// for json
+
+#include "fx_bar_series.h"// for FXBarSeries
+#include "fx_exception.h" // for FXException
+
+namespace fxordermgmt
+{
+
+std::expected<FXPriceBarsSummary, FXException> FXPriceBarParser::load_price_bars(
+    nlohmann::json const& price_bars_json, FXBarSeries& price_bars, std::int64_t after_timestamp)
+{
+    FXPriceBarsSummary summary;
+    if (! price_bars_json.is_array())
+    {
+        return std::expected<FXPriceBarsSummary, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Key 'PriceBars' must be an array"};
+    }
+
+    try
+    {
+        for (auto const& bar : price_bars_json)
+        {
+            auto const timestamp = parse_bar_date(bar.at("BarDate").get_ref<std::string const&>());
+            if (! timestamp)
+            {
+                return std::expected<FXPriceBarsSummary, FXException> {
+                    std::unexpect, std::source_location::current().function_name(), "Invalid BarDate Format"};
+            }
+            // ------------
+            ++summary.bars_received;
+            summary.last_timestamp = *timestamp;
+            if (*timestamp == after_timestamp && price_bars.size() && price_bars.date_time().back() == after_timestamp)
+            {
+                bool const revised = price_bars.replace_back(bar.at("Open").get<fx_price_t>(), bar.at("High").get<fx_price_t>(),
+                    bar.at("Low").get<fx_price_t>(), bar.at("Close").get<fx_price_t>());
+                summary.bars_revised += (revised) ? 1 : 0;
+            }
+            else if (*timestamp > after_timestamp)
+            {
+                price_bars.push_back(bar.at("Open").get<fx_price_t>(), bar.at("High").get<fx_price_t>(), bar.at("Low").get<fx_price_t>(),
+                    bar.at("Close").get<fx_price_t>(), *timestamp);
+                ++summary.bars_appended;
+            }
+        }
+    }
+    catch (nlohmann::json::exception const& e)
+    {
+        return std::expected<FXPriceBarsSummary, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "JSON Key Error: " + std::string(e.what())};
+    }
+    // -------------------
+    return std::expected<FXPriceBarsSummary, FXException> {summary};
+}
+
+bool FXPriceBarParser::bar_closed(
+    nlohmann::json const& price_bars_json, std::int64_t bar_timestamp, std::int64_t interval_seconds, std::int64_t timestamp_now)
+{
+    if (! price_bars_json.is_array())
+    {
+        return false;
+    }
+    std::optional<std::int64_t> candidate_timestamp;
+    for (auto const& bar : price_bars_json)
+    {
+        auto const timestamp = (bar.contains("BarDate") && bar["BarDate"].is_string())
+                                   ? parse_bar_date(bar["BarDate"].get_ref<std::string const&>())
+                                   : std::nullopt;
+        if (! timestamp)
+        {
+            return false;
+        }
+        if (candidate_timestamp && *timestamp > *candidate_timestamp)
+        {
+            return true;
+        }
+        if (! candidate_timestamp && *timestamp >= bar_timestamp)
+        {
+            candidate_timestamp = timestamp;
+        }
+    }
+    // -------------------
+    return candidate_timestamp && *candidate_timestamp + interval_seconds <= timestamp_now;
+}
+
+std::optional<std::int64_t> FXPriceBarParser::parse_bar_date(std::string_view bar_date) noexcept
+{
+    std::size_t const start = bar_date.find('(');
+    if (start == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+
+    std::int64_t milliseconds = 0;
+    auto const [end, error] = std::from_chars(bar_date.data() + start + 1, bar_date.data() + bar_date.size(), milliseconds);
+    if (error != std::errc {})
+    {
+        return std::nullopt;
+    }
+    // -------------------
+    return (milliseconds >= 0) ? milliseconds / 1000 : (milliseconds - 999) / 1000;
+}
+
+}// namespace fxordermgmt
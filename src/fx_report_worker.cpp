@@ -0,0 +1,65 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_report_worker.h"
+
+#include <cstddef>   // for size_t
+#include <functional>// for function
+#include <mutex>     // for unique_lock, lock_guard
+#include <optional>  // for optional
+#include <utility>   // for move
+
+namespace fxordermgmt
+{
+
+FXReportWorker::FXReportWorker(std::function<void(FXReportSnapshot const&)> report_writer)
+    : writer(std::move(report_writer)), worker(&FXReportWorker::run, this)
+{
+}
+
+FXReportWorker::~FXReportWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    snapshot_ready.notify_one();
+    worker.join();
+}
+
+void FXReportWorker::submit(FXReportSnapshot snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        dropped += pending_snapshot.has_value();
+        pending_snapshot = std::move(snapshot);
+    }
+    snapshot_ready.notify_one();
+}
+
+std::size_t FXReportWorker::dropped_snapshots() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return dropped;
+}
+
+void FXReportWorker::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        snapshot_ready.wait(lock, [this]() { return stopping || pending_snapshot.has_value(); });
+        if (! pending_snapshot)
+        {
+            return;
+        }
+        FXReportSnapshot const snapshot = std::move(*pending_snapshot);
+        pending_snapshot.reset();
+        // ------------
+        lock.unlock();
+        writer(snapshot);
+        lock.lock();
+    }
+}
+
+}// namespace fxordermgmt
@@ -0,0 +1,180 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_report_writer.h"
+
+#include <algorithm>      // for stable_sort
+#include <charconv>       // for to_chars
+#include <cmath>          // for isfinite
+#include <cstddef>        // for size_t
+#include <cstdio>         // for snprintf
+#include <expected>       // for expected
+#include <filesystem>     // for rename, exists, remove
+#include <fstream>        // for ofstream
+#include <functional>     // for hash
+#include <source_location>// for current, function_name...
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <system_error>   // for error_code, errc
+
+#include "fx_exception.h"// for FXException
+
+namespace
+{
+
+void append_string(std::string& buffer, std::string_view text)
+{
+    buffer += '"';
+    for (char const c : text)
+    {
+        switch (c)
+        {
+        case '"': buffer += "\\\""; break;
+        case '\\': buffer += "\\\\"; break;
+        case '\n': buffer += "\\n"; break;
+        case '\r': buffer += "\\r"; break;
+        case '\t': buffer += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char escaped[7];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                buffer += escaped;
+            }
+            else
+            {
+                buffer += c;
+            }
+        }
+    }
+    buffer += '"';
+}
+
+// Shortest Round-Trip Form | JSON Has No NaN or Infinity
+void append_number(std::string& buffer, double value, bool keep_floating_point)
+{
+    if (! std::isfinite(value))
+    {
+        buffer += "null";
+        return;
+    }
+    char digits[32];
+    auto const [end, error] = std::to_chars(digits, digits + sizeof(digits), value);
+    std::string_view const number(digits, (error == std::errc {}) ? end : digits);
+    buffer += number;
+    // Keeps Whole Numbers Typed as Floating Point
+    if (keep_floating_point && number.find_first_of(".e") == std::string_view::npos)
+    {
+        buffer += ".0";
+    }
+}
+
+// Integral Fields Write Whole Numbers as Integers, as the API Reports Them
+void append_field(std::string& buffer, std::string_view indent, std::string_view key, double value, bool last = false, bool integral = false)
+{
+    buffer += indent;
+    append_string(buffer, key);
+    buffer += ": ";
+    append_number(buffer, value, ! integral);
+    buffer += (last) ? "\n" : ",\n";
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+std::expected<bool, FXException> FXReportWriter::write(std::string const& file_name, FXProfitReport const& report)
+{
+    std::size_t const content_start = serialize(report);
+    std::size_t const content_hash = std::hash<std::string_view> {}(std::string_view(buffer).substr(content_start));
+
+    if (content_hash == last_content_hash && file_name == last_file_name && std::filesystem::exists(file_name))
+    {
+        return std::expected<bool, FXException> {false};
+    }
+
+    std::string const temporary_file = file_name + ".tmp";
+    std::ofstream out(temporary_file, std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+        return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(), "Report File Failed to Open"};
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.close();
+    if (! out)
+    {
+        std::error_code ignored;
+        std::filesystem::remove(temporary_file, ignored);
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Report File Failed to Write Data"};
+    }
+
+    // Rename Replaces the Previous Report in One Step
+    std::error_code rename_error;
+    std::filesystem::rename(temporary_file, file_name, rename_error);
+    if (rename_error)
+    {
+        return std::expected<bool, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Report File Failed to Replace: " + rename_error.message()};
+    }
+    // -------------------
+    last_file_name = file_name;
+    last_content_hash = content_hash;
+    return std::expected<bool, FXException> {true};
+}
+
+std::string const& FXReportWriter::contents() const noexcept { return buffer; }
+
+std::size_t FXReportWriter::serialize(FXProfitReport const& report)
+{
+    // Same Layout as the Sorted, 4 Space Indented JSON Reports Were Always Written In
+    buffer.clear();
+    buffer += "{\n    \"Last Updated\": ";
+    append_string(buffer, report.last_updated);
+    buffer += ",\n";
+    std::size_t const content_start = buffer.size();
+
+    buffer += "    \"Performance Information\": {\n";
+    append_field(buffer, "        ", "Current Funds", report.current_funds);
+    append_field(buffer, "        ", "Initial Funds", report.initial_funds);
+    append_field(buffer, "        ", "Margin Utilized", report.margin_utilized);
+    append_field(buffer, "        ", "Profit Cumulative", report.profit_cumulative);
+    append_field(buffer, "        ", "Profit Percent Cumulative", report.profit_percent_cumulative, true);
+    buffer += "    },\n";
+
+    // Ordered by Symbol; a Repeated Symbol Keeps its Last Position
+    position_order.clear();
+    for (std::size_t x = 0; x < report.positions.size(); ++x) { position_order.push_back(x); }
+    std::stable_sort(position_order.begin(), position_order.end(),
+        [&](std::size_t a, std::size_t b) { return report.positions[a].symbol < report.positions[b].symbol; });
+
+    buffer += "    \"Position Information\": {";
+    bool first = true;
+    for (std::size_t x = 0; x < position_order.size(); ++x)
+    {
+        FXPositionPerformance const& position = report.positions[position_order[x]];
+        if (x + 1 < position_order.size() && report.positions[position_order[x + 1]].symbol == position.symbol)
+        {
+            continue;
+        }
+        buffer += (first) ? "\n        " : ",\n        ";
+        first = false;
+        append_string(buffer, position.symbol);
+        buffer += ": {\n";
+        append_field(buffer, "            ", "Current Price", position.current_price);
+        buffer += "            \"Direction\": ";
+        append_string(buffer, position.direction);
+        buffer += ",\n";
+        append_field(buffer, "            ", "Entry Price", position.entry_price);
+        append_field(buffer, "            ", "Profit", position.profit);
+        append_field(buffer, "            ", "Profit Percent", position.profit_percent);
+        append_field(buffer, "            ", "Quantity", position.quantity, true, true);
+        buffer += "        }";
+    }
+    buffer += (first) ? "}\n}" : "\n    }\n}";
+    // -------------------
+    return content_start;
+}
+
+}// namespace fxordermgmt
@@ -0,0 +1,120 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_sma_crossover_model.h"
+
+#include <algorithm>      // for min
+#include <cstddef>        // for size_t
+#include <expected>       // for expected
+#include <limits>         // for numeric_limits
+#include <source_location>// for current, function_name...
+#include <span>           // for span
+#include <stdexcept>      // for invalid_argument
+#include <string>         // for string, to_string
+
+#include "fx_bar_series.h"            // for FXBarSeries, fx_price_t
+#include "fx_exception.h"             // for FXException
+#include "fx_indicators.h"            // for FXIndicators
+#include "fx_trading_model_registry.h"// for FXRegisterTradingModel
+
+namespace
+{
+
+fxordermgmt::FXRegisterTradingModel<fxordermgmt::FXSMACrossoverModel> const sma_crossover_registration {"SMA_Crossover"};
+
+std::size_t read_period(fxordermgmt::FXModelParameters const& parameters, char const* key, std::size_t default_period)
+{
+    auto const it = parameters.find(key);
+    if (it == parameters.end())
+    {
+        return default_period;
+    }
+    if (it->second < 1)
+    {
+        throw std::invalid_argument(std::string(key) + " must be at least 1");
+    }
+    return static_cast<std::size_t>(it->second);
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+FXSMACrossoverModel::FXSMACrossoverModel(FXModelParameters const& parameters)
+    : fast_period(read_period(parameters, "Fast_Period", 10)), slow_period(read_period(parameters, "Slow_Period", 30)), fast_sma(fast_period),
+      slow_sma(slow_period)
+{
+    if (fast_period >= slow_period)
+    {
+        throw std::invalid_argument("Fast_Period must be less than Slow_Period");
+    }
+}
+
+int FXSMACrossoverModel::send_trading_signal(FXBarSeries const& price_bars)
+{
+    if (price_bars.size() < slow_period)
+    {
+        return 0;
+    }
+    // Hooks Not Called (e.g. Driven Directly) | Re-Seed from the Series
+    if (price_bars.date_time().back() != last_bar_time)
+    {
+        on_history_loaded(price_bars);
+    }
+    // -------------------
+    return (fast_sma.value() > slow_sma.value()) ? 1 : -1;
+}
+
+void FXSMACrossoverModel::on_history_loaded(FXBarSeries const& price_bars)
+{
+    fast_sma.seed(price_bars.close());
+    slow_sma.seed(price_bars.close());
+    last_bar_time = (price_bars.size()) ? price_bars.date_time().back() : 0;
+}
+
+void FXSMACrossoverModel::on_new_bars(FXBarSeries const& price_bars, std::size_t new_bar_count)
+{
+    if (new_bar_count >= price_bars.size())
+    {
+        on_history_loaded(price_bars);
+        return;
+    }
+    for (fx_price_t close : price_bars.close().last(new_bar_count))
+    {
+        fast_sma.update(close);
+        slow_sma.update(close);
+    }
+    last_bar_time = price_bars.date_time().back();
+}
+
+std::expected<bool, FXException> FXSMACrossoverModel::verify_streaming_state(FXBarSeries const& price_bars)
+{
+    std::span<fx_price_t const> const window = price_bars.close().last(std::min(slow_period, price_bars.size()));
+    verify_fast.resize(window.size());
+    verify_slow.resize(window.size());
+
+    auto fast_response = FXIndicators::sma(window, fast_period, verify_fast);
+    if (! fast_response)
+    {
+        return fast_response;
+    }
+    auto slow_response = FXIndicators::sma(window, slow_period, verify_slow);
+    if (! slow_response)
+    {
+        return slow_response;
+    }
+    // Empty Window Means the Streaming State Must Not Be Ready
+    fx_price_t const batch_fast = (window.empty()) ? std::numeric_limits<fx_price_t>::quiet_NaN() : verify_fast.back();
+    fx_price_t const batch_slow = (window.empty()) ? std::numeric_limits<fx_price_t>::quiet_NaN() : verify_slow.back();
+    if (! FXIndicators::values_match(fast_sma.value(), batch_fast) || ! FXIndicators::values_match(slow_sma.value(), batch_slow))
+    {
+        return std::expected<bool, FXException> {std::unexpect, std::source_location::current().function_name(),
+            "SMA_Crossover Streaming State Diverged: Fast " + std::to_string(fast_sma.value()) + " vs " + std::to_string(batch_fast) +
+                ", Slow " + std::to_string(slow_sma.value()) + " vs " + std::to_string(batch_slow)};
+    }
+    // -------------------
+    return std::expected<bool, FXException> {true};
+}
+
+}// namespace fxordermgmt
@@ -0,0 +1,330 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_streaming_indicators.h"
+
+#include <algorithm>// for max, min
+#include <cmath>    // for abs, sqrt
+#include <cstddef>  // for size_t
+#include <limits>   // for numeric_limits
+#include <span>     // for span
+
+#include "fx_bar_series.h"// for fx_price_t
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+
+constexpr fx_price_t NOT_A_NUMBER = std::numeric_limits<fx_price_t>::quiet_NaN();
+
+// Same Convention as FXIndicators::rsi
+double relative_strength_index(double average_gain, double average_loss) noexcept
+{
+    if (average_loss <= 0)
+    {
+        return (average_gain <= 0) ? 50.0 : 100.0;
+    }
+    return 100.0 - 100.0 / (1.0 + average_gain / average_loss);
+}
+
+}// namespace
+
+namespace fxordermgmt
+{
+
+// ==============================================================================================
+// Simple Moving Average
+// ==============================================================================================
+
+FXStreamingSMA::FXStreamingSMA(std::size_t sma_period) : period(std::max<std::size_t>(sma_period, 1)), window(period) {}
+
+void FXStreamingSMA::seed(std::span<fx_price_t const> values)
+{
+    next_index = count = 0;
+    sum = 0;
+    // Only the Final Window Contributes
+    for (fx_price_t price : values.last(std::min(period, values.size()))) { update(price); }
+}
+
+fx_price_t FXStreamingSMA::update(fx_price_t price) noexcept
+{
+    if (count == period)
+    {
+        sum -= static_cast<double>(window[next_index]);
+    }
+    window[next_index] = price;
+    sum += static_cast<double>(price);
+    next_index = (next_index + 1 == period) ? 0 : next_index + 1;
+    count = std::min(count + 1, period);
+
+    // Re-Sum Once per Lap so Rounding Does Not Accumulate
+    if (! next_index && count == period)
+    {
+        sum = 0;
+        for (fx_price_t window_value : window) { sum += static_cast<double>(window_value); }
+    }
+    return value();
+}
+
+fx_price_t FXStreamingSMA::value() const noexcept { return (ready()) ? static_cast<fx_price_t>(sum / static_cast<double>(period)) : NOT_A_NUMBER; }
+
+bool FXStreamingSMA::ready() const noexcept { return count == period; }
+
+// ==============================================================================================
+// Exponential Moving Average
+// ==============================================================================================
+
+FXStreamingEMA::FXStreamingEMA(std::size_t ema_period)
+    : period(std::max<std::size_t>(ema_period, 1)), alpha(2.0 / static_cast<double>(period + 1))
+{
+}
+
+void FXStreamingEMA::seed(std::span<fx_price_t const> values) noexcept
+{
+    count = 0;
+    ema = 0;
+    for (fx_price_t price : values) { update(price); }
+}
+
+fx_price_t FXStreamingEMA::update(fx_price_t price) noexcept
+{
+    // Seeded with the SMA of the First (period) Values
+    if (count < period)
+    {
+        ema += static_cast<double>(price);
+        if (++count == period)
+        {
+            ema /= static_cast<double>(period);
+        }
+    }
+    else
+    {
+        ema += alpha * (static_cast<double>(price) - ema);
+    }
+    return value();
+}
+
+fx_price_t FXStreamingEMA::value() const noexcept { return (ready()) ? static_cast<fx_price_t>(ema) : NOT_A_NUMBER; }
+
+bool FXStreamingEMA::ready() const noexcept { return count == period; }
+
+// ==============================================================================================
+// Rolling Statistics
+// ==============================================================================================
+
+FXStreamingStats::FXStreamingStats(std::size_t stats_period) : period(std::max<std::size_t>(stats_period, 1)), window(period) {}
+
+void FXStreamingStats::seed(std::span<fx_price_t const> values)
+{
+    next_index = count = 0;
+    shift = sum = sum_sq = 0;
+    for (fx_price_t price : values.last(std::min(period, values.size()))) { update(price); }
+}
+
+void FXStreamingStats::update(fx_price_t price) noexcept
+{
+    if (! count)
+    {
+        shift = price;
+    }
+    if (count == period)
+    {
+        double const expired = static_cast<double>(window[next_index]) - shift;
+        sum -= expired;
+        sum_sq -= expired * expired;
+    }
+    window[next_index] = price;
+    double const shifted = static_cast<double>(price) - shift;
+    sum += shifted;
+    sum_sq += shifted * shifted;
+    next_index = (next_index + 1 == period) ? 0 : next_index + 1;
+    count = std::min(count + 1, period);
+
+    if (! next_index && count == period)
+    {
+        recompute_sums();
+    }
+}
+
+fx_price_t FXStreamingStats::mean() const noexcept
+{
+    return (ready()) ? static_cast<fx_price_t>(sum / static_cast<double>(period) + shift) : NOT_A_NUMBER;
+}
+
+fx_price_t FXStreamingStats::stdev() const noexcept { return (ready()) ? static_cast<fx_price_t>(std::sqrt(variance())) : NOT_A_NUMBER; }
+
+fx_price_t FXStreamingStats::zscore() const noexcept
+{
+    if (! ready())
+    {
+        return NOT_A_NUMBER;
+    }
+    double const current_variance = variance();
+    if (current_variance <= 0)
+    {
+        return 0;
+    }
+    double const latest = window[(next_index) ? next_index - 1 : period - 1];
+    return static_cast<fx_price_t>((latest - (sum / static_cast<double>(period) + shift)) / std::sqrt(current_variance));
+}
+
+fx_price_t FXStreamingStats::upper_band(fx_price_t num_stdev) const noexcept { return mean() + num_stdev * stdev(); }
+
+fx_price_t FXStreamingStats::lower_band(fx_price_t num_stdev) const noexcept { return mean() - num_stdev * stdev(); }
+
+bool FXStreamingStats::ready() const noexcept { return count == period; }
+
+double FXStreamingStats::variance() const noexcept
+{
+    double const window_size = static_cast<double>(period), shifted_mean = sum / window_size;
+    return std::max(sum_sq / window_size - shifted_mean * shifted_mean, 0.0);
+}
+
+void FXStreamingStats::recompute_sums() noexcept
+{
+    // Re-Centre on the Oldest Value & Re-Sum Once per Lap
+    shift = window[next_index];
+    sum = sum_sq = 0;
+    for (fx_price_t window_value : window)
+    {
+        double const shifted = static_cast<double>(window_value) - shift;
+        sum += shifted;
+        sum_sq += shifted * shifted;
+    }
+}
+
+// ==============================================================================================
+// Relative Strength Index
+// ==============================================================================================
+
+FXStreamingRSI::FXStreamingRSI(std::size_t rsi_period) : period(std::max<std::size_t>(rsi_period, 1)) {}
+
+void FXStreamingRSI::seed(std::span<fx_price_t const> close) noexcept
+{
+    count = 0;
+    previous_close = average_gain = average_loss = 0;
+    for (fx_price_t price : close) { update(price); }
+}
+
+fx_price_t FXStreamingRSI::update(fx_price_t close) noexcept
+{
+    // (count) Includes the First Close, Which Has No Change
+    if (! count)
+    {
+        previous_close = close;
+        ++count;
+        return NOT_A_NUMBER;
+    }
+    double const change = static_cast<double>(close - static_cast<fx_price_t>(previous_close));
+    double const gain = std::max(change, 0.0), loss = std::max(-change, 0.0), window = static_cast<double>(period);
+    previous_close = close;
+
+    if (count <= period)
+    {
+        average_gain += gain;
+        average_loss += loss;
+        if (++count > period)
+        {
+            average_gain /= window;
+            average_loss /= window;
+        }
+    }
+    else
+    {
+        average_gain = (average_gain * (window - 1) + gain) / window;
+        average_loss = (average_loss * (window - 1) + loss) / window;
+    }
+    return value();
+}
+
+fx_price_t FXStreamingRSI::value() const noexcept
+{
+    return (ready()) ? static_cast<fx_price_t>(relative_strength_index(average_gain, average_loss)) : NOT_A_NUMBER;
+}
+
+bool FXStreamingRSI::ready() const noexcept { return count > period; }
+
+// ==============================================================================================
+// Average True Range
+// ==============================================================================================
+
+FXStreamingATR::FXStreamingATR(std::size_t atr_period) : period(std::max<std::size_t>(atr_period, 1)) {}
+
+void FXStreamingATR::seed(std::span<fx_price_t const> high, std::span<fx_price_t const> low, std::span<fx_price_t const> close) noexcept
+{
+    count = 0;
+    previous_close = average_range = 0;
+    std::size_t const size = std::min({high.size(), low.size(), close.size()});
+    for (std::size_t x = 0; x < size; ++x) { update(high[x], low[x], close[x]); }
+}
+
+fx_price_t FXStreamingATR::update(fx_price_t high, fx_price_t low, fx_price_t close) noexcept
+{
+    // The First Bar Has No Previous Close
+    fx_price_t true_range = high - low;
+    if (count)
+    {
+        auto const last_close = static_cast<fx_price_t>(previous_close);
+        true_range = std::max(true_range, std::max(std::abs(high - last_close), std::abs(low - last_close)));
+    }
+    previous_close = close;
+
+    double const window = static_cast<double>(period);
+    if (count < period)
+    {
+        average_range += static_cast<double>(true_range);
+        if (++count == period)
+        {
+            average_range /= window;
+        }
+    }
+    else
+    {
+        average_range = (average_range * (window - 1) + static_cast<double>(true_range)) / window;
+    }
+    return value();
+}
+
+fx_price_t FXStreamingATR::value() const noexcept { return (ready()) ? static_cast<fx_price_t>(average_range) : NOT_A_NUMBER; }
+
+bool FXStreamingATR::ready() const noexcept { return count == period; }
+
+// ==============================================================================================
+// MACD
+// ==============================================================================================
+
+FXStreamingMACD::FXStreamingMACD(std::size_t fast_period, std::size_t slow_period, std::size_t signal_period)
+    : fast_ema(fast_period), slow_ema(slow_period), signal_ema(signal_period), macd_value(NOT_A_NUMBER)
+{
+}
+
+void FXStreamingMACD::seed(std::span<fx_price_t const> values) noexcept
+{
+    fast_ema.seed({});
+    slow_ema.seed({});
+    signal_ema.seed({});
+    macd_value = NOT_A_NUMBER;
+    for (fx_price_t price : values) { update(price); }
+}
+
+void FXStreamingMACD::update(fx_price_t price) noexcept
+{
+    fast_ema.update(price);
+    slow_ema.update(price);
+    if (fast_ema.ready() && slow_ema.ready())
+    {
+        macd_value = fast_ema.value() - slow_ema.value();
+        signal_ema.update(macd_value);
+    }
+}
+
+fx_price_t FXStreamingMACD::macd_line() const noexcept { return macd_value; }
+
+fx_price_t FXStreamingMACD::signal_line() const noexcept { return signal_ema.value(); }
+
+fx_price_t FXStreamingMACD::histogram() const noexcept { return macd_value - signal_ema.value(); }
+
+bool FXStreamingMACD::ready() const noexcept { return signal_ema.ready(); }
+
+}// namespace fxordermgmt
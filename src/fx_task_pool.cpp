@@ -0,0 +1,154 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_task_pool.h"
+
+#include <algorithm> // for min, max
+#include <atomic>    // for atomic
+#include <cstddef>   // for size_t
+#include <exception> // for exception_ptr, current_exception, rethrow_exception
+#include <functional>// for function
+#include <mutex>     // for mutex, lock_guard
+#include <thread>    // for jthread
+#include <vector>    // for vector
+
+namespace fxordermgmt
+{
+
+void FXTaskPool::parallel_for(std::size_t count, std::size_t max_concurrency, std::function<void(std::size_t)> const& task)
+{
+    std::size_t const thread_count = std::min(count, std::max<std::size_t>(max_concurrency, 1));
+    if (thread_count <= 1)
+    {
+        for (std::size_t x = 0; x < count; ++x) { task(x); }
+        return;
+    }
+
+    std::atomic<std::size_t> next_index {0};
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    auto worker = [&]() {
+        for (std::size_t x = next_index.fetch_add(1); x < count; x = next_index.fetch_add(1))
+        {
+            try
+            {
+                task(x);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock {error_mutex};
+                if (! first_error)
+                {
+                    first_error = std::current_exception();
+                }
+            }
+        }
+    };
+    // -------------------
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count - 1);
+        for (std::size_t x = 1; x < thread_count; ++x) { workers.emplace_back(worker); }
+        worker();
+    }
+
+    if (first_error)
+    {
+        std::rethrow_exception(first_error);
+    }
+}
+
+void FXTaskPool::work_stealing_for(std::size_t count, std::size_t max_concurrency, std::function<void(std::size_t)> const& task)
+{
+    std::size_t const thread_count = std::min(count, std::max<std::size_t>(max_concurrency, 1));
+    if (thread_count <= 1)
+    {
+        for (std::size_t x = 0; x < count; ++x) { task(x); }
+        return;
+    }
+
+    // Remaining Range [begin, end) per Worker; Owner Takes the Front, Thieves Take the Back Half
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex mutex;
+        std::size_t begin = 0, end = 0;
+    };
+    std::vector<WorkerQueue> queues(thread_count);
+    for (std::size_t x = 0; x < thread_count; ++x)
+    {
+        queues[x].begin = count * x / thread_count;
+        queues[x].end = count * (x + 1) / thread_count;
+    }
+
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    auto next_task = [&](std::size_t worker_id, std::size_t& index) {
+        {
+            WorkerQueue& own = queues[worker_id];
+            std::lock_guard<std::mutex> lock {own.mutex};
+            if (own.begin < own.end)
+            {
+                index = own.begin++;
+                return true;
+            }
+        }
+        // Tasks Never Spawn Tasks, so Finding Every Queue Empty Means the Work is Done
+        for (std::size_t offset = 1; offset < thread_count; ++offset)
+        {
+            WorkerQueue& victim = queues[(worker_id + offset) % thread_count];
+            std::size_t stolen_begin = 0, stolen_end = 0;
+            {
+                std::lock_guard<std::mutex> lock {victim.mutex};
+                if (victim.begin >= victim.end)
+                {
+                    continue;
+                }
+                stolen_begin = victim.begin + (victim.end - victim.begin) / 2;
+                stolen_end = victim.end;
+                victim.end = stolen_begin;
+            }
+            WorkerQueue& own = queues[worker_id];
+            std::lock_guard<std::mutex> lock {own.mutex};
+            index = stolen_begin;
+            own.begin = stolen_begin + 1;
+            own.end = stolen_end;
+            return true;
+        }
+        return false;
+    };
+
+    auto worker = [&](std::size_t worker_id) {
+        std::size_t index = 0;
+        while (next_task(worker_id, index))
+        {
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock {error_mutex};
+                if (! first_error)
+                {
+                    first_error = std::current_exception();
+                }
+            }
+        }
+    };
+    // -------------------
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count - 1);
+        for (std::size_t x = 1; x < thread_count; ++x) { workers.emplace_back(worker, x); }
+        worker(0);
+    }
+
+    if (first_error)
+    {
+        std::rethrow_exception(first_error);
+    }
+}
+
+}// namespace fxordermgmt
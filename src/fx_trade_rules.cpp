@@ -0,0 +1,46 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_trade_rules.h"
+
+#include <math.h>  // for round
+#include <optional>// for optional, nullopt
+
+namespace fxordermgmt
+{
+
+int FXTradeRules::base_quantity(int position_multiplier, int order_position_size) noexcept
+{
+    return static_cast<int>(round(position_multiplier * order_position_size / 1000) * 1000);
+}
+
+std::optional<FXTradeDecision> FXTradeRules::decide(int signal, FXPosition const& position, int base_quantity) noexcept
+{
+    // Open New Position
+    if (! position.quantity)
+    {
+        if (signal && base_quantity)
+        {
+            return FXTradeDecision {base_quantity, signal == 1, base_quantity};
+        }
+        return std::nullopt;
+    }
+    // -------------------
+    int const same_direction_signal = (position.is_buy) ? 1 : -1;
+    if (signal == same_direction_signal && position.quantity < base_quantity)
+    {
+        return FXTradeDecision {base_quantity - position.quantity, position.is_buy, base_quantity};
+    }
+    if (signal == 0)
+    {
+        return FXTradeDecision {position.quantity, ! position.is_buy, 0};
+    }
+    if (signal == -same_direction_signal)
+    {
+        return FXTradeDecision {base_quantity + position.quantity, ! position.is_buy, base_quantity};
+    }
+    // -------------------
+    return std::nullopt;
+}
+
+}// namespace fxordermgmt
@@ -4,18 +4,21 @@
 #include "fx_trading_model.h"
 
 #include <stdlib.h>// for rand, RAND_MAX
-#include <vector>  // for vector
 
-namespace fxordermgmt
+#include "fx_bar_series.h"            // for FXBarSeries
+#include "fx_trading_model_registry.h"// for FXRegisterTradingModel
+
+namespace
 {
+fxordermgmt::FXRegisterTradingModel<fxordermgmt::FXTradingModel> const placeholder_registration {"Placeholder"};
+}// namespace
 
-FXTradingModel::FXTradingModel(std::vector<float> const& open_prices, std::vector<float> const& high_prices, std::vector<float> const& low_prices,
-    std::vector<float> const& close_prices, std::vector<float> const& date_time)
-    : open_prices(open_prices), high_prices(high_prices), low_prices(low_prices), close_prices(close_prices), date_time(date_time)
+namespace fxordermgmt
 {
-}
 
-int FXTradingModel::send_trading_signal()
+FXTradingModel::FXTradingModel([[maybe_unused]] FXModelParameters const& parameters) {}
+
+int FXTradingModel::send_trading_signal([[maybe_unused]] FXBarSeries const& price_bars)
 {
     // Replace with User's Code
     return (rand() % 2) ? 1 : -1;
@@ -0,0 +1,66 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include "fx_trading_model_registry.h"
+
+#include <algorithm>      // for sort
+#include <expected>       // for expected
+#include <memory>         // for unique_ptr
+#include <source_location>// for current, function_name...
+#include <stdexcept>      // for invalid_argument
+#include <string>         // for string
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "fx_exception.h"              // for FXException
+#include "fx_trading_model_interface.h"// for ITradingModel, FXModelParameters
+
+namespace fxordermgmt
+{
+
+FXTradingModelRegistry& FXTradingModelRegistry::instance()
+{
+    static FXTradingModelRegistry registry;
+    return registry;
+}
+
+bool FXTradingModelRegistry::register_model(std::string const& name, FXModelFactory factory)
+{
+    return factories.emplace(name, std::move(factory)).second;
+}
+
+std::expected<std::unique_ptr<ITradingModel>, FXException> FXTradingModelRegistry::create(
+    std::string const& name, FXModelParameters const& parameters) const
+{
+    auto const it = factories.find(name);
+    if (it == factories.end())
+    {
+        std::string available;
+        for (std::string const& model_name : model_names()) { available += (available.empty() ? "" : ", ") + model_name; }
+        return std::expected<std::unique_ptr<ITradingModel>, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Trading Model '" + name + "' Not Registered. Available: " + available};
+    }
+    // Models Reject Bad Parameters by Throwing std::invalid_argument
+    try
+    {
+        return std::expected<std::unique_ptr<ITradingModel>, FXException> {it->second(parameters)};
+    }
+    catch (std::invalid_argument const& e)
+    {
+        return std::expected<std::unique_ptr<ITradingModel>, FXException> {
+            std::unexpect, std::source_location::current().function_name(), "Trading Model '" + name + "': " + e.what()};
+    }
+}
+
+bool FXTradingModelRegistry::contains(std::string const& name) const { return factories.contains(name); }
+
+std::vector<std::string> FXTradingModelRegistry::model_names() const
+{
+    std::vector<std::string> names;
+    names.reserve(factories.size());
+    for (auto const& [name, factory] : factories) { names.push_back(name); }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+}// namespace fxordermgmt
@@ -75,9 +75,6 @@ std::expected<std::string, FXException> FXUtilities::keyring_unlock_get_password
 
 std::expected<bool, FXException> FXUtilities::validate_user_settings(std::string& update_interval, int update_span, int& update_frequency_seconds)
 {
-    std::array<int, 7> const SPAN_M = {1, 2, 3, 5, 10, 15, 30};// Span intervals for minutes
-    std::array<int, 4> const SPAN_H = {1, 2, 4, 8};            // Span intervals for hours
-
     transform(update_interval.begin(), update_interval.end(), update_interval.begin(), ::toupper);
 
     if (update_interval != "MINUTE" && update_interval != "HOUR")
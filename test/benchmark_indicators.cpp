@@ -0,0 +1,82 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "fx_bar_series.h"
+#include "fx_indicators.h"
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+using fxordermgmt::FXIndicators;
+
+template <typename Func>
+void run_benchmark(std::string const& name, int iterations, Func&& func)
+{
+    func();// Warm Up
+    auto const start = std::chrono::steady_clock::now();
+    for (int x = 0; x < iterations; ++x) { func(); }
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    // -------------------
+    std::cout << std::format("{:<36} {:>10.1f} us/iter\n", name, static_cast<double>(elapsed) / iterations);
+}
+
+}// namespace
+
+int main()
+{
+    std::size_t const num_bars = 10'000, period = 20;
+    int const iterations = 200;
+
+    fxordermgmt::FXBarSeries price_bars {num_bars};
+    for (std::size_t x = 0; x < num_bars; ++x)
+    {
+        auto const price = static_cast<fx_price_t>(1.08 + 0.002 * std::sin(0.01 * x));
+        price_bars.push_back(price, price + 0.0005F, price - 0.0005F, price + 0.0002F, static_cast<std::int64_t>(x));
+    }
+    std::vector<fx_price_t> first(num_bars), second(num_bars), third(num_bars);
+
+    std::cout << std::format("Bar History: {} bars, period {}\n", num_bars, period);
+
+    // Typical Hand Written Loop: Each Bar Re-Sums its Whole Window
+    run_benchmark("Naive Window SMA + Stdev", iterations, [&]() {
+        auto const close = price_bars.close();
+        for (std::size_t x = period - 1; x < num_bars; ++x)
+        {
+            double sum = 0, sum_sq = 0;
+            for (std::size_t y = x + 1 - period; y <= x; ++y) { sum += close[y]; }
+            double const mean = sum / period;
+            for (std::size_t y = x + 1 - period; y <= x; ++y) { sum_sq += (close[y] - mean) * (close[y] - mean); }
+            first[x] = static_cast<fx_price_t>(mean);
+            second[x] = static_cast<fx_price_t>(std::sqrt(sum_sq / period));
+        }
+    });
+
+    run_benchmark("FXIndicators sma + rolling_stdev", iterations, [&]() {
+        auto sma_response = FXIndicators::sma(price_bars.close(), period, first);
+        auto stdev_response = FXIndicators::rolling_stdev(price_bars.close(), period, second);
+    });
+
+    run_benchmark("FXIndicators ema", iterations, [&]() { auto response = FXIndicators::ema(price_bars.close(), period, first); });
+
+    run_benchmark("FXIndicators rsi", iterations, [&]() { auto response = FXIndicators::rsi(price_bars.close(), 14, first); });
+
+    run_benchmark("FXIndicators atr", iterations,
+        [&]() { auto response = FXIndicators::atr(price_bars.high(), price_bars.low(), price_bars.close(), 14, first); });
+
+    run_benchmark("FXIndicators bollinger", iterations,
+        [&]() { auto response = FXIndicators::bollinger(price_bars.close(), period, 2, first, second, third); });
+
+    run_benchmark("FXIndicators macd", iterations,
+        [&]() { auto response = FXIndicators::macd(price_bars.close(), 12, 26, 9, first, second, third); });
+    // -------------------
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "json/json.hpp"
+
+#include "fx_bar_series.h"
+#include "fx_price_bar_parser.h"
+
+namespace
+{
+
+std::size_t allocation_count = 0;
+
+std::string build_ohlc_text(int num_bars)
+{
+    std::string text = "{\"PriceBars\": [";
+    long long timestamp = 1706745600000;
+    for (int x = 0; x < num_bars; ++x)
+    {
+        double const price = 1.08 + (x % 100) * 0.0001;
+        text += std::format("{}{{\"BarDate\":\"/Date({})/\",\"Open\":{:.5f},\"High\":{:.5f},\"Low\":{:.5f},\"Close\":{:.5f}}}", (x) ? "," : "",
+            timestamp, price, price + 0.0005, price - 0.0005, price + 0.0002);
+        timestamp += 300000;
+    }
+    return text + "]}";
+}
+
+template <typename Func>
+void run_benchmark(std::string const& name, int iterations, Func&& func)
+{
+    func();// Warm Up
+    std::size_t const start_allocations = allocation_count;
+    auto const start = std::chrono::steady_clock::now();
+    for (int x = 0; x < iterations; ++x) { func(); }
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    // -------------------
+    std::cout << std::format("{:<36} {:>10.1f} us/iter {:>12} allocs/iter\n", name, static_cast<double>(elapsed) / iterations,
+        (allocation_count - start_allocations) / iterations);
+}
+
+}// namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+int main()
+{
+    int const num_bars = 10'000, iterations = 50;
+    std::string const ohlc_text = build_ohlc_text(num_bars);
+    fxordermgmt::FXBarSeries price_bars {static_cast<std::size_t>(num_bars)};
+
+    std::cout << std::format("PriceBars Payload: {} bars, {} bytes\n", num_bars, ohlc_text.size());
+
+    // Previous return_price_history Path; Offset Corrected to Skip the Opening Quote
+    run_benchmark("DOM + operator[] + dump().substr()", iterations, [&]() {
+        nlohmann::json ohlc_json = nlohmann::json::parse(ohlc_text);
+        price_bars.clear();
+        for (int x = 0; x < num_bars; ++x)
+        {
+            price_bars.push_back(ohlc_json["PriceBars"][x]["Open"], ohlc_json["PriceBars"][x]["High"], ohlc_json["PriceBars"][x]["Low"],
+                ohlc_json["PriceBars"][x]["Close"], std::stoll(ohlc_json["PriceBars"][x]["BarDate"].dump().substr(7, 10)));
+        }
+    });
+
+    run_benchmark("DOM + FXPriceBarParser::load", iterations, [&]() {
+        nlohmann::json const ohlc_json = nlohmann::json::parse(ohlc_text);
+        price_bars.clear();
+        auto response = fxordermgmt::FXPriceBarParser::load_price_bars(ohlc_json["PriceBars"], price_bars);
+    });
+    // -------------------
+    return 0;
+}
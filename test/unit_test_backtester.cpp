@@ -0,0 +1,150 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_backtester.h"
+#include "fx_bar_series.h"
+#include "fx_trade_rules.h"
+#include "fx_trading_model_interface.h"
+#include "fx_trading_model_registry.h"
+
+namespace
+{
+
+using fxordermgmt::FXPosition;
+using fxordermgmt::FXTradeRules;
+
+// Buy Above 1.5, Sell Below 0.5, Otherwise Close
+class ThresholdSignalModel : public fxordermgmt::ITradingModel
+{
+  public:
+    explicit ThresholdSignalModel(fxordermgmt::FXModelParameters const&) {}
+
+    int send_trading_signal(fxordermgmt::FXBarSeries const& price_bars) override
+    {
+        fxordermgmt::fx_price_t const close = price_bars.close().back();
+        return (close > 1.5F) ? 1 : (close < 0.5F) ? -1 : 0;
+    }
+};
+
+fxordermgmt::FXRegisterTradingModel<ThresholdSignalModel> const threshold_signal_registration {"Unit_Test_Threshold_Signal"};
+
+fxordermgmt::FXBarHistory make_history(std::vector<fxordermgmt::fx_price_t> const& closes)
+{
+    fxordermgmt::FXBarHistory history;
+    for (std::size_t x = 0; x < closes.size(); ++x)
+    {
+        history.date_time.push_back(static_cast<std::int64_t>(1'700'000'000 + 60 * x));
+        history.open.push_back(closes[x]);
+        history.high.push_back(closes[x]);
+        history.low.push_back(closes[x]);
+        history.close.push_back(closes[x]);
+    }
+    return history;
+}
+
+TEST(FXBacktesterTests, Trade_Rules_Match_Live_Positions)
+{
+    EXPECT_FALSE(FXTradeRules::decide(0, FXPosition {}, 1000));
+    EXPECT_FALSE(FXTradeRules::decide(1, FXPosition {}, 0));
+
+    auto open = FXTradeRules::decide(-1, FXPosition {}, 1000);
+    ASSERT_TRUE(open);
+    EXPECT_EQ(open->quantity, 1000);
+    EXPECT_FALSE(open->is_buy);
+
+    auto top_up = FXTradeRules::decide(1, FXPosition {400, true}, 1000);
+    ASSERT_TRUE(top_up);
+    EXPECT_EQ(top_up->quantity, 600);
+    EXPECT_TRUE(top_up->is_buy);
+    EXPECT_FALSE(FXTradeRules::decide(1, FXPosition {1000, true}, 1000));
+
+    auto close = FXTradeRules::decide(0, FXPosition {1000, false}, 1000);
+    ASSERT_TRUE(close);
+    EXPECT_EQ(close->quantity, 1000);
+    EXPECT_TRUE(close->is_buy);
+    EXPECT_EQ(close->final_quantity, 0);
+
+    auto reverse = FXTradeRules::decide(-1, FXPosition {1000, true}, 1000);
+    ASSERT_TRUE(reverse);
+    EXPECT_EQ(reverse->quantity, 2000);
+    EXPECT_FALSE(reverse->is_buy);
+    EXPECT_EQ(reverse->final_quantity, 1000);
+
+    EXPECT_EQ(FXTradeRules::base_quantity(2, 1000), 2000);
+    EXPECT_STREQ(FXTradeRules::direction_name(false), "sell");
+}
+
+TEST(FXBacktesterTests, Replay_Profit_And_Drawdown)
+{
+    fxordermgmt::FXBacktestConfig config;
+    config.model_config.model_name = "Unit_Test_Threshold_Signal";
+    config.num_data_points = 1;
+
+    auto response = fxordermgmt::FXBacktester::run("EUR/USD", make_history({1, 1, 2, 3, 1, 0.2F, 1}), config);
+    ASSERT_TRUE(response);
+
+    auto const& result = response.value();
+    EXPECT_EQ(result.order_count, 4);
+    EXPECT_EQ(result.closed_trades, 2);
+    EXPECT_EQ(result.winning_trades, 0);
+    EXPECT_EQ(result.traded_volume, 4000);
+    EXPECT_NEAR(result.realized_profit, -1800, 1e-3);
+    EXPECT_NEAR(result.max_drawdown, 2800, 1e-3);
+    EXPECT_EQ(result.final_position.quantity, 0);
+
+    config.spread = 0.2;
+    auto spread_response = fxordermgmt::FXBacktester::run("EUR/USD", make_history({1, 1, 2, 3, 1, 0.2F, 1}), config);
+    ASSERT_TRUE(spread_response);
+    EXPECT_NEAR(spread_response.value().realized_profit, -2200, 1e-3);
+
+    nlohmann::json const report = fxordermgmt::FXBacktester::build_report({result}, config);
+    EXPECT_EQ(report["Position Information"]["EUR/USD"]["Orders"], 4);
+    EXPECT_NEAR(report["Performance Information"]["Profit Cumulative"].get<double>(), -1800, 1e-2);
+}
+
+TEST(FXBacktesterTests, Replay_Requires_Full_Window)
+{
+    fxordermgmt::FXBacktestConfig config;
+    config.num_data_points = 10;
+    EXPECT_FALSE(fxordermgmt::FXBacktester::run("EUR/USD", make_history({1, 2, 3}), config));
+
+    config.num_data_points = 1;
+    config.model_config.model_name = "Does_Not_Exist";
+    EXPECT_FALSE(fxordermgmt::FXBacktester::run("EUR/USD", make_history({1, 2, 3}), config));
+}
+
+TEST(FXBacktesterTests, CSV_And_Binary_Round_Trip)
+{
+    std::filesystem::path const dir = std::filesystem::temp_directory_path() / "fx_backtester_test";
+    std::filesystem::create_directories(dir);
+    std::string const csv_file = (dir / "EUR_USD.csv").string(), binary_file = (dir / "EUR_USD.fxbars").string();
+
+    std::ofstream(csv_file) << "DateTime,Open,High,Low,Close\n1700000000,1.1,1.2,1.0,1.15\r\n1700000060, 1.15,1.25,1.05,1.2\n\n";
+    auto csv_response = fxordermgmt::FXBacktester::load_csv_bars(csv_file);
+    ASSERT_TRUE(csv_response);
+    ASSERT_EQ(csv_response.value().size(), 2);
+    EXPECT_EQ(csv_response.value().date_time[1], 1700000060);
+    EXPECT_FLOAT_EQ(csv_response.value().close[1], 1.2F);
+
+    ASSERT_TRUE(fxordermgmt::FXBacktester::write_binary_bars(binary_file, csv_response.value()));
+    auto binary_response = fxordermgmt::FXBacktester::load_binary_bars(binary_file);
+    ASSERT_TRUE(binary_response);
+    EXPECT_EQ(binary_response.value().date_time, csv_response.value().date_time);
+    EXPECT_EQ(binary_response.value().high, csv_response.value().high);
+
+    std::ofstream(csv_file) << "1700000000,1.1,1.2,1.0\n";
+    EXPECT_FALSE(fxordermgmt::FXBacktester::load_csv_bars(csv_file));
+    std::ofstream(csv_file) << "1700000060,1.1,1.2,1.0,1.1\n1700000000,1.1,1.2,1.0,1.1\n";
+    EXPECT_FALSE(fxordermgmt::FXBacktester::load_csv_bars(csv_file));
+
+    std::filesystem::remove_all(dir);
+}
+
+}// namespace
@@ -0,0 +1,119 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_bar_series.h"
+
+namespace
+{
+
+template <typename T>
+std::vector<T> to_vector(std::span<T const> column)
+{
+    return {column.begin(), column.end()};
+}
+
+using Prices = std::vector<fxordermgmt::fx_price_t>;
+using Timestamps = std::vector<std::int64_t>;
+
+TEST(FXBarSeriesTests, Default_Constructor)
+{
+    fxordermgmt::FXBarSeries bars {};
+
+    EXPECT_EQ(bars.size(), 0);
+    EXPECT_EQ(bars.capacity(), 0);
+    EXPECT_FALSE(bars.full());
+    EXPECT_TRUE(bars.close().empty());
+
+    bars.push_back(1.0, 1.0, 1.0, 1.0, 1.0);
+    EXPECT_EQ(bars.size(), 0);
+}
+
+TEST(FXBarSeriesTests, Push_Back_Before_Full)
+{
+    fxordermgmt::FXBarSeries bars {4};
+
+    bars.push_back(1.0, 2.0, 0.5, 1.5, 100);
+    bars.push_back(1.5, 2.5, 1.0, 2.0, 200);
+
+    EXPECT_EQ(bars.size(), 2);
+    EXPECT_FALSE(bars.full());
+    EXPECT_EQ(to_vector(bars.open()), (Prices {1.0, 1.5}));
+    EXPECT_EQ(to_vector(bars.high()), (Prices {2.0, 2.5}));
+    EXPECT_EQ(to_vector(bars.low()), (Prices {0.5, 1.0}));
+    EXPECT_EQ(to_vector(bars.close()), (Prices {1.5, 2.0}));
+    EXPECT_EQ(to_vector(bars.date_time()), (Timestamps {100, 200}));
+}
+
+TEST(FXBarSeriesTests, Wrap_Around_Stays_Contiguous)
+{
+    fxordermgmt::FXBarSeries bars {3};
+
+    for (int x = 1; x <= 7; ++x) { bars.push_back(x, x, x, x, x * 10); }
+
+    EXPECT_TRUE(bars.full());
+    EXPECT_EQ(bars.size(), 3);
+    EXPECT_EQ(to_vector(bars.close()), (Prices {5.0, 6.0, 7.0}));
+    EXPECT_EQ(to_vector(bars.date_time()), (Timestamps {50, 60, 70}));
+    EXPECT_EQ(bars.close().last(2)[1], 7.0);
+}
+
+TEST(FXBarSeriesTests, Replace_Back_After_Wrap_Around)
+{
+    fxordermgmt::FXBarSeries bars {3};
+
+    EXPECT_FALSE(bars.replace_back(1.0, 1.0, 1.0, 1.0));
+    for (int x = 1; x <= 3; ++x) { bars.push_back(x, x, x, x, x * 10); }
+
+    EXPECT_FALSE(bars.replace_back(3.0, 3.0, 3.0, 3.0));
+    EXPECT_TRUE(bars.replace_back(3.0, 3.5, 2.5, 3.25));
+    EXPECT_EQ(to_vector(bars.close()), (Prices {1.0, 2.0, 3.25}));
+    EXPECT_EQ(to_vector(bars.date_time()), (Timestamps {10, 20, 30}));
+
+    bars.push_back(4.0, 4.0, 4.0, 4.0, 40);
+    EXPECT_EQ(to_vector(bars.high()), (Prices {2.0, 3.5, 4.0}));
+}
+
+TEST(FXBarSeriesTests, Column_Alignment)
+{
+    fxordermgmt::FXBarSeries bars {5};
+    bars.push_back(1.0, 1.0, 1.0, 1.0, 1.0);
+
+    for (auto column : {bars.open(), bars.high(), bars.low(), bars.close()})
+    {
+        // Single Bar is Viewed From its Mirror Copy; Column Base is Cache Line Aligned
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(column.data() - bars.capacity()) % 64, 0);
+    }
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(bars.date_time().data() - bars.capacity()) % 64, 0);
+}
+
+TEST(FXBarSeriesTests, Timestamps_Keep_Second_Precision)
+{
+    fxordermgmt::FXBarSeries bars {2};
+    bars.push_back(1.0, 1.0, 1.0, 1.0, 1706745600);
+    bars.push_back(1.0, 1.0, 1.0, 1.0, 1706745660);
+
+    // A Float Column Cannot Separate Bars One Minute Apart at Current Epoch Times
+    EXPECT_EQ(bars.date_time()[1] - bars.date_time()[0], 60);
+}
+
+TEST(FXBarSeriesTests, Clear)
+{
+    fxordermgmt::FXBarSeries bars {2};
+    bars.push_back(1.0, 1.0, 1.0, 1.0, 1.0);
+    bars.push_back(2.0, 2.0, 2.0, 2.0, 2.0);
+    bars.clear();
+
+    EXPECT_EQ(bars.size(), 0);
+    EXPECT_TRUE(bars.open().empty());
+
+    bars.push_back(3.0, 3.0, 3.0, 3.0, 3.0);
+    EXPECT_EQ(to_vector(bars.open()), (Prices {3.0}));
+}
+
+}// namespace
@@ -0,0 +1,122 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_control_channel.h"
+
+namespace
+{
+
+using fxordermgmt::FXControlChannel;
+
+// Sends One Command Line; the Reply is Read After the Channel Has Answered
+int send_command(std::string const& socket_path, std::string const& line)
+{
+    int const client_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    socket_path.copy(address.sun_path, socket_path.size());
+    EXPECT_EQ(connect(client_fd, reinterpret_cast<sockaddr const*>(&address), sizeof(address)), 0);
+    EXPECT_EQ(write(client_fd, line.data(), line.size()), static_cast<ssize_t>(line.size()));
+    return client_fd;
+}
+
+bool is_managed(std::string_view symbol) { return symbol == "EUR/USD" || symbol == "USD/CAD"; }
+
+std::string read_reply(int client_fd)
+{
+    char buffer[256];
+    ssize_t const length = read(client_fd, buffer, sizeof(buffer));
+    close(client_fd);
+    return (length > 0) ? std::string(buffer, static_cast<std::size_t>(length)) : std::string {};
+}
+
+TEST(FXControlChannelTests, Parse_Command)
+{
+    auto close_all = FXControlChannel::parse_command("close all\r");
+    ASSERT_TRUE(close_all);
+    EXPECT_TRUE(close_all->close_all);
+    EXPECT_TRUE(close_all->symbols.empty());
+
+    auto close_symbols = FXControlChannel::parse_command("  CLOSE EUR/USD\tUSD/CAD ");
+    ASSERT_TRUE(close_symbols);
+    EXPECT_FALSE(close_symbols->close_all);
+    EXPECT_EQ(close_symbols->symbols, (std::vector<std::string> {"EUR/USD", "USD/CAD"}));
+
+    EXPECT_FALSE(FXControlChannel::parse_command(""));
+    EXPECT_FALSE(FXControlChannel::parse_command("CLOSE"));
+    EXPECT_FALSE(FXControlChannel::parse_command("OPEN EUR/USD"));
+}
+
+TEST(FXControlChannelTests, Receive_And_Reply)
+{
+    std::string const socket_path = (std::filesystem::temp_directory_path() / "fx_control_test.sock").string();
+    {
+        FXControlChannel control_channel;
+        ASSERT_TRUE(control_channel.listen(socket_path));
+        EXPECT_TRUE(control_channel.is_listening());
+        EXPECT_TRUE(control_channel.receive(is_managed).empty());
+
+        int const first_client = send_command(socket_path, "CLOSE EUR/USD\n");
+        int const second_client = send_command(socket_path, "CLOSE ALL\n");
+        int const bad_client = send_command(socket_path, "HELLO\n");
+        int const unmanaged_client = send_command(socket_path, "CLOSE EUR/USD GBP/JPY\n");
+
+        auto const commands = control_channel.receive(is_managed);
+        ASSERT_EQ(commands.size(), 2);
+        EXPECT_EQ(commands[0].symbols, (std::vector<std::string> {"EUR/USD"}));
+        EXPECT_TRUE(commands[1].close_all);
+
+        EXPECT_EQ(read_reply(first_client), "OK\n");
+        EXPECT_EQ(read_reply(second_client), "OK\n");
+        EXPECT_EQ(read_reply(bad_client).rfind("ERROR", 0), 0);
+        EXPECT_EQ(read_reply(unmanaged_client), "ERROR Symbol Not Managed: GBP/JPY\n");
+
+        // Another Instance is Still Listening
+        FXControlChannel second_instance;
+        EXPECT_FALSE(second_instance.listen(socket_path));
+        EXPECT_FALSE(second_instance.is_listening());
+        EXPECT_TRUE(std::filesystem::exists(socket_path));
+    }
+    EXPECT_FALSE(std::filesystem::exists(socket_path));
+}
+
+TEST(FXControlChannelTests, Stale_Socket_Replaced)
+{
+    std::string const socket_path = (std::filesystem::temp_directory_path() / "fx_control_stale_test.sock").string();
+    std::filesystem::remove(socket_path);
+
+    // Bound, then Closed Without Removing the Path, as After a Crash
+    int const stale_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    socket_path.copy(address.sun_path, socket_path.size());
+    ASSERT_EQ(bind(stale_fd, reinterpret_cast<sockaddr const*>(&address), sizeof(address)), 0);
+    close(stale_fd);
+    ASSERT_TRUE(std::filesystem::exists(socket_path));
+
+    FXControlChannel control_channel;
+    EXPECT_TRUE(control_channel.listen(socket_path));
+    int const client = send_command(socket_path, "CLOSE USD/CAD\n");
+    EXPECT_EQ(control_channel.receive(is_managed).size(), 1);
+    EXPECT_EQ(read_reply(client), "OK\n");
+}
+
+TEST(FXControlChannelTests, Path_Too_Long_Error)
+{
+    FXControlChannel control_channel;
+    EXPECT_FALSE(control_channel.listen("/tmp/" + std::string(200, 'a')));
+    EXPECT_FALSE(control_channel.is_listening());
+    EXPECT_TRUE(control_channel.receive(is_managed).empty());
+}
+
+}// namespace
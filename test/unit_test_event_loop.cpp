@@ -0,0 +1,137 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <sys/eventfd.h>
+#include <thread>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "fx_event_loop.h"
+
+namespace
+{
+
+using fxordermgmt::FXEventLoop;
+namespace ch = std::chrono;
+
+void signal_event(int fd)
+{
+    std::uint64_t const increment = 1;
+    ASSERT_EQ(write(fd, &increment, sizeof(increment)), static_cast<ssize_t>(sizeof(increment)));
+}
+
+void clear_event(int fd)
+{
+    std::uint64_t count = 0;
+    ASSERT_EQ(read(fd, &count, sizeof(count)), static_cast<ssize_t>(sizeof(count)));
+}
+
+TEST(FXEventLoopTests, Absolute_Deadline)
+{
+    FXEventLoop event_loop;
+    ASSERT_TRUE(event_loop.initialize());
+
+    auto const deadline = ch::system_clock::now() + ch::milliseconds(50);
+    EXPECT_TRUE(event_loop.run_once(deadline));
+    auto const late = ch::system_clock::now() - deadline;
+    EXPECT_GE(late, ch::milliseconds(0));
+    EXPECT_LT(late, ch::milliseconds(20));
+
+    // Deadlines Already Passed Return at Once
+    EXPECT_TRUE(event_loop.run_once(ch::system_clock::now() - ch::seconds(1)));
+}
+
+TEST(FXEventLoopTests, Sources_Dispatched_Only_By_Run)
+{
+    FXEventLoop event_loop;
+    ASSERT_TRUE(event_loop.initialize());
+    int const source_fd = eventfd(0, EFD_NONBLOCK);
+    int handled = 0;
+    ASSERT_TRUE(event_loop.add_source(source_fd, [&]() {
+        clear_event(source_fd);
+        ++handled;
+        // Nested Waits Don't Re-Enter Handlers or Lose the Outer Deadline
+        signal_event(source_fd);
+        EXPECT_TRUE(event_loop.wait_for(ch::milliseconds(5)));
+        clear_event(source_fd);
+    }));
+
+    signal_event(source_fd);
+    EXPECT_TRUE(event_loop.wait_for(ch::milliseconds(10)));
+    EXPECT_EQ(handled, 0);
+
+    EXPECT_TRUE(event_loop.run_once(ch::system_clock::now() + ch::seconds(5)));
+    EXPECT_EQ(handled, 1);
+    close(source_fd);
+}
+
+TEST(FXEventLoopTests, Run_Once_Returns_After_Dispatch)
+{
+    FXEventLoop event_loop;
+    ASSERT_TRUE(event_loop.initialize());
+    int const source_fd = eventfd(0, EFD_NONBLOCK);
+    int handled = 0;
+    ASSERT_TRUE(event_loop.add_source(source_fd, [&]() {
+        clear_event(source_fd);
+        ++handled;
+    }));
+
+    signal_event(source_fd);
+    auto const start = ch::system_clock::now();
+    EXPECT_TRUE(event_loop.run_once(start + ch::seconds(5)));
+    EXPECT_EQ(handled, 1);
+    EXPECT_LT(ch::system_clock::now() - start, ch::seconds(1));
+
+    // Nothing Ready Waits Out the Deadline
+    auto const deadline = ch::system_clock::now() + ch::milliseconds(20);
+    EXPECT_TRUE(event_loop.run_once(deadline));
+    EXPECT_EQ(handled, 1);
+    EXPECT_GE(ch::system_clock::now(), deadline);
+    close(source_fd);
+}
+
+TEST(FXEventLoopTests, Shutdown_Wakes_Early)
+{
+    FXEventLoop event_loop;
+    ASSERT_TRUE(event_loop.initialize());
+
+    std::thread requester([&]() {
+        std::this_thread::sleep_for(ch::milliseconds(20));
+        event_loop.request_shutdown();
+    });
+    auto const start = ch::steady_clock::now();
+    EXPECT_FALSE(event_loop.run_once(ch::system_clock::now() + ch::seconds(10)));
+    EXPECT_LT(ch::steady_clock::now() - start, ch::seconds(5));
+    EXPECT_TRUE(event_loop.shutdown_requested());
+    requester.join();
+
+    // The Wake-Up is Consumed, Yet Later Waits Still Return at Once
+    EXPECT_FALSE(event_loop.wait_for(ch::seconds(10)));
+    EXPECT_FALSE(event_loop.run_once(ch::system_clock::now() + ch::seconds(10)));
+    EXPECT_LT(ch::steady_clock::now() - start, ch::seconds(5));
+}
+
+TEST(FXEventLoopTests, SIGTERM_Requests_Shutdown)
+{
+    FXEventLoop event_loop;
+    ASSERT_TRUE(event_loop.initialize());
+    ASSERT_EQ(raise(SIGTERM), 0);
+    EXPECT_FALSE(event_loop.wait_for(ch::seconds(10)));
+    EXPECT_TRUE(event_loop.shutdown_requested());
+}
+
+TEST(FXEventLoopTests, Uninitialized_Sleeps)
+{
+    FXEventLoop event_loop;
+    EXPECT_FALSE(event_loop.is_initialized());
+    EXPECT_FALSE(event_loop.add_source(0, []() {}));
+    auto const start = ch::steady_clock::now();
+    EXPECT_TRUE(event_loop.wait_for(ch::milliseconds(10)));
+    EXPECT_GE(ch::steady_clock::now() - start, ch::milliseconds(10));
+}
+
+}// namespace
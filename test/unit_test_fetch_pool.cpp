@@ -0,0 +1,102 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <poll.h>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_fetch_pool.h"
+
+namespace
+{
+
+using fxordermgmt::FXFetchPool;
+
+bool wait_readable(int fd, int timeout_ms)
+{
+    pollfd poll_fd {fd, POLLIN, 0};
+    return poll(&poll_fd, 1, timeout_ms) == 1;
+}
+
+TEST(FXFetchPoolTests, Completions_Signalled_With_Ids)
+{
+    FXFetchPool fetch_pool;
+    ASSERT_TRUE(fetch_pool.start(2));
+    EXPECT_FALSE(wait_readable(fetch_pool.native_handle(), 0));
+
+    std::vector<int> results(3, 0);
+    for (std::size_t x = 0; x < results.size(); ++x)
+    {
+        fetch_pool.submit(x, [&results, x]() { results[x] = static_cast<int>(x) + 1; });
+    }
+
+    std::vector<std::size_t> finished;
+    while (finished.size() < results.size())
+    {
+        ASSERT_TRUE(wait_readable(fetch_pool.native_handle(), 1000));
+        for (std::size_t const id : fetch_pool.take_completed()) { finished.push_back(id); }
+    }
+    EXPECT_EQ(results, (std::vector<int> {1, 2, 3}));
+    EXPECT_FALSE(wait_readable(fetch_pool.native_handle(), 0));
+    EXPECT_TRUE(fetch_pool.take_completed().empty());
+}
+
+TEST(FXFetchPoolTests, Slow_Request_Does_Not_Hold_Others)
+{
+    std::promise<void> release_slow;
+    std::shared_future<void> released = release_slow.get_future().share();
+    {
+        FXFetchPool fetch_pool;
+        ASSERT_TRUE(fetch_pool.start(2));
+        fetch_pool.submit(0, [released]() { released.wait(); });
+        fetch_pool.submit(1, []() {});
+        fetch_pool.submit(2, []() {});
+
+        // The Fast Requests Finish While the Slow One is Still Running
+        std::vector<std::size_t> finished;
+        while (finished.size() < 2)
+        {
+            ASSERT_TRUE(wait_readable(fetch_pool.native_handle(), 1000));
+            for (std::size_t const id : fetch_pool.take_completed()) { finished.push_back(id); }
+        }
+        EXPECT_EQ(finished, (std::vector<std::size_t> {1, 2}));
+
+        release_slow.set_value();
+        ASSERT_TRUE(wait_readable(fetch_pool.native_handle(), 1000));
+        EXPECT_EQ(fetch_pool.take_completed(), (std::vector<std::size_t> {0}));
+    }
+}
+
+TEST(FXFetchPoolTests, Destructor_Drops_Queued_Requests)
+{
+    std::atomic<int> calls {0};
+    std::promise<void> first_started;
+    std::shared_future<void> started = first_started.get_future().share();
+    std::atomic<bool> release_first {false};
+    {
+        // Declared First so it Outlives the Pool's Join
+        std::jthread releaser([&]() {
+            started.wait();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            release_first = true;
+        });
+        FXFetchPool fetch_pool;
+        ASSERT_TRUE(fetch_pool.start(1));
+        fetch_pool.submit(0, [&]() {
+            ++calls;
+            first_started.set_value();
+            while (! release_first) { std::this_thread::yield(); }
+        });
+        for (std::size_t x = 1; x < 5; ++x) { fetch_pool.submit(x, [&]() { ++calls; }); }
+        started.wait();
+    }
+    EXPECT_EQ(calls.load(), 1);
+}
+
+}// namespace
@@ -0,0 +1,76 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "fx_file_watcher.h"
+
+namespace
+{
+
+using fxordermgmt::FXFileWatcher;
+
+class FXFileWatcherTests : public testing::Test
+{
+  protected:
+    std::filesystem::path watch_dir = std::filesystem::temp_directory_path() / "fx_file_watcher_test";
+    std::string file_name = (watch_dir / "active_order_management.json").string();
+
+    void SetUp() override
+    {
+        std::filesystem::remove_all(watch_dir);
+        std::filesystem::create_directories(watch_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(watch_dir); }
+
+    static void write_file(std::string const& path, std::string const& text)
+    {
+        std::ofstream out(path);
+        out << text;
+    }
+};
+
+TEST_F(FXFileWatcherTests, Detects_Writes_To_Watched_File_Only)
+{
+    FXFileWatcher watcher;
+    ASSERT_TRUE(watcher.watch(file_name));
+    EXPECT_TRUE(watcher.is_watching());
+    EXPECT_FALSE(watcher.changed());
+
+    write_file((watch_dir / "other.json").string(), "{}");
+    EXPECT_FALSE(watcher.changed());
+
+    write_file(file_name, "{}");
+    EXPECT_TRUE(watcher.changed());
+    // Events Were Drained
+    EXPECT_FALSE(watcher.changed());
+}
+
+TEST_F(FXFileWatcherTests, Detects_Replace_By_Rename_And_Removal)
+{
+    write_file(file_name, "{}");
+    FXFileWatcher watcher;
+    ASSERT_TRUE(watcher.watch(file_name));
+
+    write_file(file_name + ".tmp", "{\"EUR/USD\": {}}");
+    std::filesystem::rename(file_name + ".tmp", file_name);
+    EXPECT_TRUE(watcher.changed());
+
+    std::filesystem::remove(file_name);
+    EXPECT_TRUE(watcher.changed());
+}
+
+TEST_F(FXFileWatcherTests, Missing_Directory_Error)
+{
+    FXFileWatcher watcher;
+    EXPECT_FALSE(watcher.watch((watch_dir / "missing" / "active_order_management.json").string()));
+    EXPECT_FALSE(watcher.is_watching());
+    EXPECT_FALSE(watcher.changed());
+}
+
+}// namespace
@@ -0,0 +1,215 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_bar_series.h"
+#include "fx_indicators.h"
+#include "fx_sma_crossover_model.h"
+#include "fx_trading_model_registry.h"
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+using fxordermgmt::FXIndicators;
+
+constexpr double TOLERANCE = 1e-4;
+
+// Odd Length so SIMD Loops Also Exercise the Scalar Tail
+std::vector<fx_price_t> make_prices(std::size_t size)
+{
+    std::vector<fx_price_t> prices(size);
+    for (std::size_t x = 0; x < size; ++x) { prices[x] = static_cast<fx_price_t>(1.08 + 0.002 * std::sin(0.1 * x) + 0.0001 * (x % 7)); }
+    return prices;
+}
+
+double reference_mean(std::span<fx_price_t const> values, std::size_t end, std::size_t period)
+{
+    double sum = 0;
+    for (std::size_t x = end + 1 - period; x <= end; ++x) { sum += values[x]; }
+    return sum / period;
+}
+
+double reference_stdev(std::span<fx_price_t const> values, std::size_t end, std::size_t period)
+{
+    double const mean = reference_mean(values, end, period);
+    double sum_sq = 0;
+    for (std::size_t x = end + 1 - period; x <= end; ++x) { sum_sq += (values[x] - mean) * (values[x] - mean); }
+    return std::sqrt(sum_sq / period);
+}
+
+std::vector<double> reference_ema(std::span<fx_price_t const> values, std::size_t period)
+{
+    std::vector<double> ema(values.size(), NAN);
+    ema[period - 1] = reference_mean(values, period - 1, period);
+    for (std::size_t x = period; x < values.size(); ++x) { ema[x] = ema[x - 1] + 2.0 / (period + 1) * (values[x] - ema[x - 1]); }
+    return ema;
+}
+
+TEST(FXIndicatorsTests, SMA_Matches_Reference)
+{
+    std::vector<fx_price_t> const prices = make_prices(1'003);
+    std::vector<fx_price_t> out(prices.size());
+
+    ASSERT_TRUE(FXIndicators::sma(prices, 20, out));
+
+    EXPECT_TRUE(std::isnan(out[18]));
+    for (std::size_t x = 19; x < prices.size(); ++x) { EXPECT_NEAR(out[x], reference_mean(prices, x, 20), TOLERANCE); }
+}
+
+TEST(FXIndicatorsTests, EMA_Matches_Reference)
+{
+    std::vector<fx_price_t> const prices = make_prices(257);
+    std::vector<fx_price_t> out(prices.size());
+
+    ASSERT_TRUE(FXIndicators::ema(prices, 12, out));
+
+    std::vector<double> const expected = reference_ema(prices, 12);
+    EXPECT_TRUE(std::isnan(out[10]));
+    for (std::size_t x = 11; x < prices.size(); ++x) { EXPECT_NEAR(out[x], expected[x], TOLERANCE); }
+}
+
+TEST(FXIndicatorsTests, Stdev_ZScore_Bollinger)
+{
+    std::vector<fx_price_t> const prices = make_prices(301);
+    std::vector<fx_price_t> stdev(prices.size()), zscore(prices.size()), upper(prices.size()), middle(prices.size()), lower(prices.size());
+
+    ASSERT_TRUE(FXIndicators::rolling_stdev(prices, 20, stdev));
+    ASSERT_TRUE(FXIndicators::zscore(prices, 20, zscore));
+    ASSERT_TRUE(FXIndicators::bollinger(prices, 20, 2, upper, middle, lower));
+
+    for (std::size_t x = 19; x < prices.size(); ++x)
+    {
+        double const mean = reference_mean(prices, x, 20), sd = reference_stdev(prices, x, 20);
+        EXPECT_NEAR(stdev[x], sd, TOLERANCE);
+        EXPECT_NEAR(zscore[x], (prices[x] - mean) / sd, 1e-2);
+        EXPECT_NEAR(middle[x], mean, TOLERANCE);
+        EXPECT_NEAR(upper[x], mean + 2 * sd, TOLERANCE);
+        EXPECT_NEAR(lower[x], mean - 2 * sd, TOLERANCE);
+    }
+}
+
+TEST(FXIndicatorsTests, RSI_Bounds_And_Flat_Series)
+{
+    std::vector<fx_price_t> rising(50), out(50);
+    for (std::size_t x = 0; x < rising.size(); ++x) { rising[x] = static_cast<fx_price_t>(1.0 + 0.01 * x); }
+
+    ASSERT_TRUE(FXIndicators::rsi(rising, 14, out));
+    EXPECT_TRUE(std::isnan(out[13]));
+    EXPECT_FLOAT_EQ(out[14], 100);
+    EXPECT_FLOAT_EQ(out.back(), 100);
+
+    std::vector<fx_price_t> const flat(50, 1.1F);
+    ASSERT_TRUE(FXIndicators::rsi(flat, 14, out));
+    EXPECT_FLOAT_EQ(out.back(), 50);
+
+    std::vector<fx_price_t> const prices = make_prices(400);
+    std::vector<fx_price_t> mixed(prices.size());
+    ASSERT_TRUE(FXIndicators::rsi(prices, 14, mixed));
+    for (std::size_t x = 14; x < mixed.size(); ++x)
+    {
+        EXPECT_GE(mixed[x], 0);
+        EXPECT_LE(mixed[x], 100);
+    }
+}
+
+TEST(FXIndicatorsTests, ATR_Matches_Reference)
+{
+    std::vector<fx_price_t> const close = make_prices(203);
+    std::vector<fx_price_t> high(close.size()), low(close.size()), out(close.size());
+    for (std::size_t x = 0; x < close.size(); ++x)
+    {
+        high[x] = close[x] + 0.0005F;
+        low[x] = close[x] - 0.0003F;
+    }
+
+    ASSERT_TRUE(FXIndicators::atr(high, low, close, 14, out));
+
+    double atr = 0;
+    for (std::size_t x = 0; x < close.size(); ++x)
+    {
+        double const true_range = (x) ? std::max<double>({high[x] - low[x], std::abs(high[x] - close[x - 1]), std::abs(low[x] - close[x - 1])})
+                                      : high[x] - low[x];
+        if (x < 14)
+        {
+            atr += true_range / 14;
+        }
+        else
+        {
+            atr = (atr * 13 + true_range) / 14;
+        }
+        if (x >= 13)
+        {
+            EXPECT_NEAR(out[x], atr, TOLERANCE);
+        }
+    }
+}
+
+TEST(FXIndicatorsTests, MACD_Matches_Reference)
+{
+    std::vector<fx_price_t> const prices = make_prices(501);
+    std::vector<fx_price_t> macd_line(prices.size()), signal_line(prices.size()), histogram(prices.size());
+
+    ASSERT_TRUE(FXIndicators::macd(prices, 12, 26, 9, macd_line, signal_line, histogram));
+
+    std::vector<double> const fast = reference_ema(prices, 12), slow = reference_ema(prices, 26);
+    std::vector<fx_price_t> reference_macd(prices.size() - 25);
+    for (std::size_t x = 25; x < prices.size(); ++x) { reference_macd[x - 25] = static_cast<fx_price_t>(fast[x] - slow[x]); }
+    std::vector<double> const signal = reference_ema(reference_macd, 9);
+
+    EXPECT_TRUE(std::isnan(macd_line[24]));
+    EXPECT_TRUE(std::isnan(signal_line[32]));
+    for (std::size_t x = 33; x < prices.size(); ++x)
+    {
+        EXPECT_NEAR(macd_line[x], fast[x] - slow[x], TOLERANCE);
+        EXPECT_NEAR(signal_line[x], signal[x - 25], TOLERANCE);
+        EXPECT_NEAR(histogram[x], macd_line[x] - signal_line[x], TOLERANCE);
+    }
+}
+
+TEST(FXIndicatorsTests, Short_Input_Is_All_NaN)
+{
+    std::vector<fx_price_t> const prices = make_prices(5);
+    std::vector<fx_price_t> out(prices.size());
+
+    ASSERT_TRUE(FXIndicators::sma(prices, 20, out));
+    EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](fx_price_t value) { return std::isnan(value); }));
+}
+
+TEST(FXIndicatorsTests, Invalid_Arguments)
+{
+    std::vector<fx_price_t> prices = make_prices(30);
+    std::vector<fx_price_t> out(prices.size()), short_out(10);
+
+    EXPECT_FALSE(FXIndicators::sma(prices, 0, out));
+    EXPECT_FALSE(FXIndicators::sma(prices, 5, short_out));
+    EXPECT_FALSE(FXIndicators::ema(prices, 5, prices));
+}
+
+TEST(FXIndicatorsTests, SMA_Crossover_Model)
+{
+    auto& registry = fxordermgmt::FXTradingModelRegistry::instance();
+    EXPECT_FALSE(registry.create("SMA_Crossover", {{"Fast_Period", 30}, {"Slow_Period", 10}}));
+
+    auto response = registry.create("SMA_Crossover", {{"Fast_Period", 2}, {"Slow_Period", 4}});
+    ASSERT_TRUE(response);
+
+    fxordermgmt::FXBarSeries bars {10};
+    bars.push_back(1, 1, 1, 1.0F, 1);
+    EXPECT_EQ(response.value()->send_trading_signal(bars), 0);
+
+    for (int x = 2; x <= 6; ++x) { bars.push_back(1, 1, 1, static_cast<fx_price_t>(1.0 + 0.1 * x), x); }
+    EXPECT_EQ(response.value()->send_trading_signal(bars), 1);
+
+    for (int x = 7; x <= 10; ++x) { bars.push_back(1, 1, 1, static_cast<fx_price_t>(2.0 - 0.2 * x), x); }
+    EXPECT_EQ(response.value()->send_trading_signal(bars), -1);
+}
+
+}// namespace
@@ -0,0 +1,151 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "json/json.hpp"
+
+#include "fx_order_book.h"
+#include "fx_order_intent.h"
+
+namespace
+{
+
+using fxordermgmt::FXOrderBook;
+using fxordermgmt::FXOrderSide;
+using fxordermgmt::FXOrderState;
+
+fxordermgmt::FXOrderSubmission make_submission(std::int64_t order_id, fxordermgmt::fx_symbol_id_t symbol_id, FXOrderSide side, int quantity,
+    int status_id = 1)
+{
+    fxordermgmt::FXOrderSubmission submission;
+    submission.intent = fxordermgmt::FXOrderIntent {symbol_id, side, quantity, quantity};
+    submission.order_id = order_id;
+    submission.status_id = status_id;
+    submission.accepted = true;
+    return submission;
+}
+
+TEST(FXOrderBookTests, Lifecycle_Transitions)
+{
+    FXOrderBook order_book;
+    EXPECT_TRUE(order_book.submit(make_submission(10, 0, FXOrderSide::BUY, 1000)));
+    EXPECT_FALSE(order_book.submit(make_submission(10, 0, FXOrderSide::BUY, 1000)));
+
+    auto rejected = make_submission(11, 0, FXOrderSide::BUY, 1000);
+    rejected.accepted = false;
+    EXPECT_FALSE(order_book.submit(rejected));
+    EXPECT_EQ(order_book.working_orders(), 1);
+
+    EXPECT_TRUE(order_book.apply_status(10, 2));
+    EXPECT_EQ(order_book.find(10)->state, FXOrderState::WORKING);
+    EXPECT_FALSE(order_book.apply_status(10, 1));
+    EXPECT_FALSE(order_book.apply_status(10, 8));
+    EXPECT_FALSE(order_book.apply_status(99, 2));
+
+    EXPECT_TRUE(order_book.apply_fill(10, 400));
+    EXPECT_EQ(order_book.find(10)->state, FXOrderState::PARTIALLY_FILLED);
+    EXPECT_FALSE(order_book.transition(10, FXOrderState::WORKING));
+    EXPECT_FALSE(order_book.apply_fill(10, 300));
+    EXPECT_TRUE(order_book.apply_status(10, 3));
+    EXPECT_EQ(order_book.find(10)->state, FXOrderState::FILLED);
+    EXPECT_EQ(order_book.find(10)->filled_quantity, 1000);
+    EXPECT_FALSE(order_book.transition(10, FXOrderState::CANCELLED));
+    EXPECT_EQ(order_book.working_orders(), 0);
+
+    order_book.clear_terminal_orders();
+    EXPECT_EQ(order_book.find(10), nullptr);
+}
+
+TEST(FXOrderBookTests, Outstanding_Exposure_Per_Symbol)
+{
+    FXOrderBook order_book;
+    ASSERT_TRUE(order_book.submit(make_submission(1, 0, FXOrderSide::BUY, 1000)));
+    ASSERT_TRUE(order_book.submit(make_submission(2, 0, FXOrderSide::SELL, 3000)));
+    ASSERT_TRUE(order_book.submit(make_submission(3, 2, FXOrderSide::SELL, 2000)));
+    ASSERT_TRUE(order_book.submit(make_submission(4, 2, FXOrderSide::BUY, 1000, 3)));
+    EXPECT_EQ(order_book.outstanding_exposure(0), -2000);
+    EXPECT_EQ(order_book.outstanding_exposure(1), 0);
+    EXPECT_EQ(order_book.outstanding_exposure(2), -2000);
+    EXPECT_EQ(order_book.outstanding_exposure(7), 0);
+
+    EXPECT_TRUE(order_book.apply_status(2, 2));
+    EXPECT_EQ(order_book.outstanding_exposure(0), -2000);
+    EXPECT_TRUE(order_book.apply_status(3, 4));
+    EXPECT_EQ(order_book.outstanding_exposure(2), 0);
+
+    // Orders Missing from the Active List May Have Filled or Been Rejected; Neither is Assumed
+    EXPECT_EQ(order_book.mark_unlisted_orders({2}), (std::vector<std::int64_t> {1}));
+    EXPECT_EQ(order_book.find(1)->state, FXOrderState::UNKNOWN);
+    EXPECT_EQ(order_book.find(2)->state, FXOrderState::WORKING);
+    EXPECT_FALSE(order_book.transition(1, FXOrderState::FILLED));
+    EXPECT_EQ(order_book.outstanding_exposure(0), -3000);
+    EXPECT_EQ(order_book.working_orders(), 1);
+}
+
+TEST(FXOrderBookTests, Working_Orders_Cancelled_At_Deadline)
+{
+    FXOrderBook order_book;
+    ASSERT_TRUE(order_book.submit(make_submission(20, 0, FXOrderSide::BUY, 1000)));
+    ASSERT_TRUE(order_book.submit(make_submission(21, 1, FXOrderSide::SELL, 2000)));
+    ASSERT_TRUE(order_book.submit(make_submission(22, 1, FXOrderSide::SELL, 500, 3)));
+
+    // Still Working When the Deadline Passes; Both the Pending & the Working Order Must be Cancelled
+    EXPECT_TRUE(order_book.apply_status(21, 2));
+    auto live_order_ids = order_book.live_order_ids();
+    std::sort(live_order_ids.begin(), live_order_ids.end());
+    EXPECT_EQ(live_order_ids, (std::vector<std::int64_t> {20, 21}));
+    EXPECT_EQ(order_book.outstanding_exposure(1), -2000);
+
+    for (std::int64_t const order_id : live_order_ids) { EXPECT_TRUE(order_book.transition(order_id, FXOrderState::CANCELLED)); }
+    EXPECT_TRUE(order_book.live_order_ids().empty());
+    EXPECT_EQ(order_book.outstanding_exposure(0), 0);
+    EXPECT_EQ(order_book.outstanding_exposure(1), 0);
+    EXPECT_EQ(order_book.working_orders(), 0);
+}
+
+TEST(FXOrderBookTests, Trade_Response_Acceptance)
+{
+    // Instruction Status 5 (Pending) with a Live Order is Still Accepted
+    nlohmann::json const pending_instruction = nlohmann::json::parse(R"({
+        "OrderId": 4200, "StatusReason": 1, "Status": 5, "Actions": [], "Quotes": [],
+        "Orders": [{"OrderId": 4200, "StatusReason": 1, "Status": 1, "Price": 1.0835, "Quantity": 1000, "OrderTypeId": 1}]})");
+    fxordermgmt::FXOrderSubmission submission;
+    FXOrderBook::read_trade_response(pending_instruction, submission);
+    EXPECT_TRUE(submission.accepted);
+    EXPECT_EQ(submission.order_id, 4200);
+    EXPECT_EQ(submission.status_id, 1);
+
+    nlohmann::json const rejected_order = nlohmann::json::parse(R"({
+        "OrderId": 4201, "StatusReason": 1, "Status": 1, "Actions": [], "Quotes": [],
+        "Orders": [{"OrderId": 4201, "StatusReason": 11, "StatusId": 5, "Price": 1.0835, "Quantity": 1000}]})");
+    fxordermgmt::FXOrderSubmission rejected;
+    FXOrderBook::read_trade_response(rejected_order, rejected);
+    EXPECT_FALSE(rejected.accepted);
+    EXPECT_FALSE(rejected.error_message.empty());
+
+    // Executed on Submission | A Quantity Short of the Intent is a Partial Fill
+    nlohmann::json const partial_fill = nlohmann::json::parse(R"({
+        "OrderId": 4202, "StatusReason": 1, "Status": 1, "Actions": [], "Quotes": [],
+        "Orders": [{"OrderId": 4202, "StatusReason": 1, "StatusId": 3, "Price": 1.0835, "Quantity": 600}]})");
+    fxordermgmt::FXOrderSubmission partial = make_submission(0, 0, FXOrderSide::SELL, 1000, 0);
+    FXOrderBook::read_trade_response(partial_fill, partial);
+    EXPECT_TRUE(partial.accepted);
+    EXPECT_EQ(partial.filled_quantity, 600);
+
+    FXOrderBook order_book;
+    ASSERT_TRUE(order_book.submit(partial));
+    EXPECT_EQ(order_book.find(4202)->state, FXOrderState::PARTIALLY_FILLED);
+    EXPECT_EQ(order_book.outstanding_exposure(0), -400);
+
+    // No Order Created
+    nlohmann::json const no_order = nlohmann::json::parse(R"({"OrderId": 0, "StatusReason": 10, "Status": 4, "Orders": []})");
+    fxordermgmt::FXOrderSubmission missing;
+    FXOrderBook::read_trade_response(no_order, missing);
+    EXPECT_FALSE(missing.accepted);
+}
+
+}// namespace
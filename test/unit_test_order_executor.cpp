@@ -0,0 +1,190 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "json/json.hpp"
+
+#include "fx_exception.h"
+#include "fx_order_executor.h"
+#include "fx_order_gateway.h"
+#include "fx_order_intent.h"
+
+namespace
+{
+
+using fxordermgmt::FXException;
+using fxordermgmt::FXOrderExecutor;
+using fxordermgmt::FXOrderIntent;
+using fxordermgmt::FXOrderSide;
+
+// Short Deadline so a Working Order is Cancelled Within a Few Polls
+constexpr fxordermgmt::FXExecutionTiming TEST_TIMING {std::chrono::milliseconds {1}, std::chrono::milliseconds {2},
+    std::chrono::milliseconds {20}};
+
+nlohmann::json trade_response(std::int64_t order_id, int status_id, int quantity)
+{
+    return {{"OrderId", order_id},
+        {"Status", 1},
+        {"Orders", nlohmann::json::array({{{"OrderId", order_id}, {"StatusId", status_id}, {"Quantity", quantity}}})}};
+}
+
+nlohmann::json active_order(std::int64_t order_id, int status_id)
+{
+    return {{"TradeOrder", {{"OrderId", order_id}, {"StatusId", status_id}}}};
+}
+
+// Scripted Broker | Records Every Call the Executor Makes
+class FakeGateway : public fxordermgmt::IOrderGateway
+{
+  public:
+    std::function<nlohmann::json(FXOrderIntent const&, int)> on_trade_order;
+    nlohmann::json active_orders = nlohmann::json::array();
+    nlohmann::json positions = nlohmann::json::array();
+    bool market_ids_resolve = true;
+
+    std::vector<FXOrderIntent> traded_intents;
+    std::vector<std::int64_t> cancelled_order_ids;
+    int position_downloads = 0;
+    int active_order_polls = 0;
+
+    bool resolve_market_id(fxordermgmt::fx_symbol_id_t) override { return market_ids_resolve; }
+
+    std::expected<nlohmann::json, FXException> trade_order(FXOrderIntent const& intent) override
+    {
+        std::lock_guard<std::mutex> const lock(trade_mutex);
+        traded_intents.push_back(intent);
+        return on_trade_order(intent, static_cast<int>(traded_intents.size()));
+    }
+
+    std::expected<nlohmann::json, FXException> list_active_orders() override
+    {
+        ++active_order_polls;
+        return nlohmann::json {{"ActiveOrders", active_orders}};
+    }
+
+    std::expected<nlohmann::json, FXException> cancel_order(std::int64_t order_id) override
+    {
+        cancelled_order_ids.push_back(order_id);
+        return nlohmann::json {{"OrderId", order_id}};
+    }
+
+    std::expected<bool, FXException> load_open_positions() override
+    {
+        if (! positions_current)
+        {
+            ++position_downloads;
+            positions_current = true;
+        }
+        return true;
+    }
+
+    void invalidate_open_positions() noexcept override { positions_current = false; }
+
+    nlohmann::json const& open_positions() const noexcept override { return positions; }
+
+    bool wait_for(std::chrono::milliseconds duration) override
+    {
+        std::this_thread::sleep_for(duration);
+        return true;
+    }
+
+  private:
+    std::mutex trade_mutex;
+    bool positions_current = false;
+};
+
+class FXOrderExecutorTests : public testing::Test
+{
+  protected:
+    fxordermgmt::FXSymbolTable symbol_table;
+    fxordermgmt::fx_symbol_id_t const eur_usd = symbol_table.intern("EUR/USD");
+    FakeGateway gateway;
+    FXOrderExecutor executor {gateway, symbol_table, TEST_TIMING};
+};
+
+TEST_F(FXOrderExecutorTests, Filled_On_Submission_Skips_Position_Download)
+{
+    gateway.on_trade_order = [](FXOrderIntent const& intent, int call) { return trade_response(100 + call, 3, intent.quantity); };
+    std::vector<FXOrderIntent> order_intents {{eur_usd, FXOrderSide::BUY, 1000, 1000}};
+
+    ASSERT_TRUE(executor.execute(order_intents, 4));
+    EXPECT_TRUE(order_intents.empty());
+    EXPECT_EQ(gateway.traded_intents.size(), 1);
+    EXPECT_EQ(gateway.active_order_polls, 0);
+    EXPECT_EQ(gateway.position_downloads, 0);
+}
+
+TEST_F(FXOrderExecutorTests, Partial_Fill_Sizes_Next_Round)
+{
+    // 600 of 1000 Fill at Once; the Remainder Works Until the Deadline Cancels It
+    gateway.on_trade_order = [](FXOrderIntent const& intent, int call) {
+        return (call == 1) ? trade_response(101, 3, 600) : trade_response(100 + call, 3, intent.quantity);
+    };
+    gateway.active_orders.push_back(active_order(101, 2));
+    std::vector<FXOrderIntent> order_intents {{eur_usd, FXOrderSide::SELL, 1000, 1000}};
+
+    ASSERT_TRUE(executor.execute(order_intents, 4));
+    EXPECT_TRUE(order_intents.empty());
+    ASSERT_EQ(gateway.traded_intents.size(), 2);
+    EXPECT_EQ(gateway.traded_intents[0].quantity, 1000);
+    EXPECT_EQ(gateway.traded_intents[1].quantity, 400);
+    EXPECT_EQ(gateway.traded_intents[1].side, FXOrderSide::SELL);
+    EXPECT_EQ(gateway.cancelled_order_ids, std::vector<std::int64_t> {101});
+    EXPECT_EQ(executor.orders().find(101)->filled_quantity, 600);
+    EXPECT_EQ(gateway.position_downloads, 0);
+}
+
+TEST_F(FXOrderExecutorTests, Working_Order_Cancelled_At_Deadline)
+{
+    // Cancelled Before the Next Round, so the Resubmission Does Not Stack on a Live Order
+    gateway.on_trade_order = [](FXOrderIntent const& intent, int call) {
+        return (call == 1) ? trade_response(101, 2, intent.quantity) : trade_response(100 + call, 3, intent.quantity);
+    };
+    gateway.active_orders.push_back(active_order(101, 2));
+    std::vector<FXOrderIntent> order_intents {{eur_usd, FXOrderSide::BUY, 1000, 1000}};
+
+    ASSERT_TRUE(executor.execute(order_intents, 4));
+    EXPECT_TRUE(order_intents.empty());
+    ASSERT_EQ(gateway.traded_intents.size(), 2);
+    EXPECT_EQ(gateway.traded_intents[1].quantity, 1000);
+    EXPECT_EQ(gateway.cancelled_order_ids, std::vector<std::int64_t> {101});
+    EXPECT_GE(gateway.active_order_polls, 2);
+    EXPECT_EQ(gateway.position_downloads, 0);
+}
+
+TEST_F(FXOrderExecutorTests, Unlisted_Order_Confirmed_Against_Positions)
+{
+    // Pending on Submission, then Gone from the Active List Without a Final Status
+    gateway.on_trade_order = [](FXOrderIntent const& intent, int call) { return trade_response(100 + call, 1, intent.quantity); };
+    gateway.positions.push_back({{"MarketName", "EUR/USD"}, {"Quantity", 1000}, {"Direction", "buy"}});
+    std::vector<FXOrderIntent> order_intents {{eur_usd, FXOrderSide::BUY, 1000, 1000}};
+
+    ASSERT_TRUE(executor.execute(order_intents, 4));
+    EXPECT_TRUE(order_intents.empty());
+    EXPECT_EQ(gateway.traded_intents.size(), 1);
+    EXPECT_TRUE(gateway.cancelled_order_ids.empty());
+    EXPECT_EQ(gateway.position_downloads, 1);
+}
+
+TEST_F(FXOrderExecutorTests, Unresolved_Market_Id_Not_Submitted)
+{
+    gateway.market_ids_resolve = false;
+    gateway.on_trade_order = [](FXOrderIntent const& intent, int call) { return trade_response(100 + call, 3, intent.quantity); };
+    std::vector<FXOrderIntent> order_intents {{eur_usd, FXOrderSide::BUY, 1000, 1000}};
+
+    ASSERT_TRUE(executor.execute(order_intents, 4));
+    ASSERT_EQ(order_intents.size(), 1);
+    EXPECT_EQ(order_intents[0].quantity, 1000);
+    EXPECT_TRUE(gateway.traded_intents.empty());
+    EXPECT_EQ(gateway.position_downloads, 0);
+}
+
+}// namespace
@@ -0,0 +1,53 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <stdexcept>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "fx_order_intent.h"
+#include "fx_trade_rules.h"
+
+namespace
+{
+
+using fxordermgmt::FXOrderIntent;
+using fxordermgmt::FXOrderSide;
+
+TEST(FXOrderIntentTests, Symbol_Table_Interns_Dense_Ids)
+{
+    fxordermgmt::FXSymbolTable symbol_table;
+    EXPECT_EQ(symbol_table.intern("EUR/USD"), 0);
+    EXPECT_EQ(symbol_table.intern("USD/JPY"), 1);
+    EXPECT_EQ(symbol_table.intern("EUR/USD"), 0);
+    EXPECT_EQ(symbol_table.size(), 2);
+
+    EXPECT_EQ(symbol_table.find("USD/JPY"), 1);
+    EXPECT_FALSE(symbol_table.find("GBP/USD"));
+    // Heterogeneous Lookup on a View Into a Longer Buffer
+    std::string_view const market_names = "USD/JPYEUR/USD";
+    EXPECT_EQ(symbol_table.find(market_names.substr(7)), 0);
+    EXPECT_EQ(symbol_table.intern(market_names.substr(0, 7)), 1);
+    EXPECT_EQ(symbol_table.name(1), "USD/JPY");
+    EXPECT_THROW(static_cast<void>(symbol_table.name(2)), std::out_of_range);
+}
+
+TEST(FXOrderIntentTests, Intent_From_Decision)
+{
+    auto const decision = fxordermgmt::FXTradeRules::decide(-1, fxordermgmt::FXPosition {1000, true}, 1000);
+    ASSERT_TRUE(decision);
+
+    FXOrderIntent const intent = FXOrderIntent::from_decision(3, *decision);
+    EXPECT_EQ(intent.symbol_id, 3);
+    EXPECT_EQ(intent.side, FXOrderSide::SELL);
+    EXPECT_EQ(intent.quantity, 2000);
+    EXPECT_EQ(intent.final_quantity, 1000);
+
+    EXPECT_STREQ(FXOrderIntent::side_name(intent.side), "sell");
+    EXPECT_EQ(FXOrderIntent::parse_side("buy"), FXOrderSide::BUY);
+    EXPECT_FALSE(FXOrderIntent::parse_side("BUY"));
+    EXPECT_EQ(FXOrderIntent::opposite(FXOrderSide::BUY), FXOrderSide::SELL);
+}
+
+}// namespace
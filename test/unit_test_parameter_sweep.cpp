@@ -0,0 +1,150 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_backtester.h"
+#include "fx_bar_series.h"
+#include "fx_parameter_sweep.h"
+#include "fx_trading_model_interface.h"
+#include "fx_trading_model_registry.h"
+
+namespace
+{
+
+using fxordermgmt::FXParameterSweep;
+
+// Long While Close is Above Buy_Above, Otherwise Flat
+class SweepThresholdModel : public fxordermgmt::ITradingModel
+{
+  public:
+    explicit SweepThresholdModel(fxordermgmt::FXModelParameters const& parameters)
+        : buy_above(parameters.contains("Buy_Above") ? parameters.at("Buy_Above") : 1.0)
+    {
+    }
+
+    int send_trading_signal(fxordermgmt::FXBarSeries const& price_bars) override { return (price_bars.close().back() > buy_above) ? 1 : 0; }
+
+  private:
+    double buy_above;
+};
+
+fxordermgmt::FXRegisterTradingModel<SweepThresholdModel> const sweep_threshold_registration {"Unit_Test_Sweep_Threshold"};
+
+fxordermgmt::FXBarHistory make_history(std::vector<fxordermgmt::fx_price_t> const& closes, std::int64_t spacing = 60)
+{
+    fxordermgmt::FXBarHistory history;
+    for (std::size_t x = 0; x < closes.size(); ++x)
+    {
+        history.date_time.push_back(1'699'999'840 + spacing * static_cast<std::int64_t>(x));
+        history.open.push_back(closes[x]);
+        history.high.push_back(closes[x] + 0.5F);
+        history.low.push_back(closes[x] - 0.5F);
+        history.close.push_back(closes[x]);
+    }
+    return history;
+}
+
+TEST(FXParameterSweepTests, Parse_Parameter_Grid)
+{
+    auto grid = FXParameterSweep::parse_parameter_grid("Fast_Period=5|10,Slow_Period=20:40:10");
+    ASSERT_TRUE(grid);
+    ASSERT_EQ(grid.value().size(), 6);
+    EXPECT_DOUBLE_EQ(grid.value().front().at("Fast_Period"), 5);
+    EXPECT_DOUBLE_EQ(grid.value().front().at("Slow_Period"), 20);
+    EXPECT_DOUBLE_EQ(grid.value().back().at("Fast_Period"), 10);
+    EXPECT_DOUBLE_EQ(grid.value().back().at("Slow_Period"), 40);
+
+    auto fractional = FXParameterSweep::parse_parameter_grid("Threshold=0.1:0.3:0.1");
+    ASSERT_TRUE(fractional);
+    EXPECT_EQ(fractional.value().size(), 3);
+
+    auto empty = FXParameterSweep::parse_parameter_grid("");
+    ASSERT_TRUE(empty);
+    EXPECT_EQ(empty.value().size(), 1);
+
+    EXPECT_FALSE(FXParameterSweep::parse_parameter_grid("Fast_Period"));
+    EXPECT_FALSE(FXParameterSweep::parse_parameter_grid("Fast_Period=a|2"));
+    EXPECT_FALSE(FXParameterSweep::parse_parameter_grid("Fast_Period=10:5:1"));
+    EXPECT_FALSE(FXParameterSweep::parse_parameter_grid("Fast_Period=1:5:0"));
+}
+
+TEST(FXParameterSweepTests, Parse_Spans)
+{
+    auto spans = FXParameterSweep::parse_spans("minute:1,15;HOUR:4");
+    ASSERT_TRUE(spans);
+    ASSERT_EQ(spans.value().size(), 3);
+    EXPECT_EQ(spans.value()[1].update_interval, "MINUTE");
+    EXPECT_EQ(spans.value()[1].span_seconds, 900);
+    EXPECT_EQ(spans.value()[2].span_seconds, 14400);
+
+    auto all_spans = FXParameterSweep::parse_spans("ALL");
+    ASSERT_TRUE(all_spans);
+    EXPECT_EQ(all_spans.value().size(), 11);
+
+    EXPECT_FALSE(FXParameterSweep::parse_spans("MINUTE:7"));
+    EXPECT_FALSE(FXParameterSweep::parse_spans("DAY:1"));
+}
+
+TEST(FXParameterSweepTests, Resample_Buckets_OHLC)
+{
+    auto resampled = FXParameterSweep::resample(make_history({1, 2, 3, 4, 5, 6, 7}), 300);
+    ASSERT_TRUE(resampled);
+
+    // First Bar Falls at 40 Seconds Past a 5 Minute Boundary
+    auto const& bars = resampled.value();
+    ASSERT_EQ(bars.size(), 2);
+    EXPECT_EQ(bars.date_time[0], 1'699'999'800);
+    EXPECT_EQ(bars.date_time[1], 1'700'000'100);
+    EXPECT_FLOAT_EQ(bars.open[0], 1);
+    EXPECT_FLOAT_EQ(bars.close[0], 5);
+    EXPECT_FLOAT_EQ(bars.high[0], 5.5F);
+    EXPECT_FLOAT_EQ(bars.low[0], 0.5F);
+    EXPECT_FLOAT_EQ(bars.open[1], 6);
+    EXPECT_FLOAT_EQ(bars.close[1], 7);
+
+    EXPECT_FALSE(FXParameterSweep::resample(make_history({1, 2, 3}, 3600), 60));
+    EXPECT_FALSE(FXParameterSweep::resample(make_history({1, 2, 3}, 120), 300));
+}
+
+TEST(FXParameterSweepTests, Run_Ranks_By_Profit)
+{
+    fxordermgmt::FXBacktestConfig config;
+    config.model_config.model_name = "Unit_Test_Sweep_Threshold";
+    config.num_data_points = 1;
+
+    auto grid = FXParameterSweep::parse_parameter_grid("Buy_Above=0.5|2.5|10");
+    auto spans = FXParameterSweep::parse_spans("MINUTE:1");
+    ASSERT_TRUE(grid && spans);
+
+    std::vector<fxordermgmt::FXBarHistory> const histories {make_history({1, 2, 3, 4, 5, 6, 7}), make_history({1, 2, 3}, 3600)};
+    auto summary = FXParameterSweep::run({"EUR/USD", "USD/JPY"}, histories, spans.value(), grid.value(), config, 4);
+    ASSERT_TRUE(summary);
+
+    // Hourly Bars Cannot be Resampled to (1) Minute
+    auto const& results = summary.value().results;
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(summary.value().skipped_jobs, 3);
+    EXPECT_FALSE(summary.value().first_skip_reason.empty());
+    EXPECT_EQ(FXParameterSweep::format_parameters(results[0].parameters), "Buy_Above=0.5");
+    EXPECT_NEAR(results[0].total_profit, 6000, 1e-2);
+    EXPECT_NEAR(results[1].total_profit, 4000, 1e-2);
+    EXPECT_EQ(results[2].result.order_count, 0);
+
+    std::filesystem::path const file = std::filesystem::temp_directory_path() / "fx_sweep_test" / "results.csv";
+    ASSERT_TRUE(FXParameterSweep::write_results_table(file.string(), summary.value()));
+    std::ifstream in(file);
+    std::string header, first_row;
+    std::getline(in, header);
+    std::getline(in, first_row);
+    EXPECT_EQ(first_row.rfind("1,EUR/USD,MINUTE,1,Buy_Above=0.5,", 0), 0);
+    std::filesystem::remove_all(file.parent_path());
+}
+
+}// namespace
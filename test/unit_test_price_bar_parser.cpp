@@ -0,0 +1,122 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "json/json.hpp"
+
+#include "fx_bar_series.h"
+#include "fx_price_bar_parser.h"
+
+namespace
+{
+
+std::string const OHLC_TEXT = R"({"PriceBars": [
+    {"BarDate": "/Date(1706745600000)/", "Open": 1.0850, "High": 1.0870, "Low": 1.0840, "Close": 1.0860},
+    {"Close": 1.0865, "BarDate": "/Date(1706745900000)/", "Open": 1.0860, "Low": 1.0855, "High": 1.0875, "Extra": {"Nested": [1, 2]}},
+    {"BarDate": "/Date(1706746200000)/", "Open": 1.0865, "High": 1.0880, "Low": 1.0860, "Close": 1.0870}
+], "PartialPriceBar": {"BarDate": "/Date(1706746500000)/", "Open": 1.0870, "High": 1.0870, "Low": 1.0870, "Close": 1.0870}})";
+
+TEST(FXPriceBarParserTests, Parse_Bar_Date)
+{
+    EXPECT_EQ(fxordermgmt::FXPriceBarParser::parse_bar_date("/Date(1706745600000)/"), 1706745600);
+    EXPECT_EQ(fxordermgmt::FXPriceBarParser::parse_bar_date("/Date(1706745600999+0000)/"), 1706745600);
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::parse_bar_date("1706745600000").has_value());
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::parse_bar_date("/Date()/").has_value());
+}
+
+TEST(FXPriceBarParserTests, Load_Price_Bars)
+{
+    fxordermgmt::FXBarSeries bars {10};
+    nlohmann::json const ohlc_json = nlohmann::json::parse(OHLC_TEXT);
+    auto response = fxordermgmt::FXPriceBarParser::load_price_bars(ohlc_json["PriceBars"], bars);
+
+    if (response)
+    {
+        EXPECT_EQ(response.value().bars_received, 3);
+        EXPECT_EQ(response.value().bars_appended, 3);
+        EXPECT_EQ(response.value().last_timestamp, 1706746200);
+        EXPECT_FLOAT_EQ(bars.open()[1], 1.0860);
+        EXPECT_FLOAT_EQ(bars.high()[1], 1.0875);
+        EXPECT_FLOAT_EQ(bars.low()[2], 1.0860);
+        EXPECT_FLOAT_EQ(bars.close()[0], 1.0860);
+        EXPECT_EQ(std::vector<std::int64_t>(bars.date_time().begin(), bars.date_time().end()),
+            (std::vector<std::int64_t> {1706745600, 1706745900, 1706746200}));
+    }
+    else
+    {
+        FAIL() << response.error().what();
+    }
+}
+
+TEST(FXPriceBarParserTests, Load_Price_Bars_After_Timestamp)
+{
+    fxordermgmt::FXBarSeries bars {10};
+    nlohmann::json const ohlc_json = nlohmann::json::parse(OHLC_TEXT);
+    auto response = fxordermgmt::FXPriceBarParser::load_price_bars(ohlc_json["PriceBars"], bars, 1706745900);
+
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response.value().bars_received, 3);
+    EXPECT_EQ(response.value().bars_appended, 1);
+    EXPECT_EQ(bars.size(), 1);
+    EXPECT_FLOAT_EQ(bars.close()[0], 1.0870);
+}
+
+TEST(FXPriceBarParserTests, Load_Price_Bars_Revises_Newest_Bar)
+{
+    fxordermgmt::FXBarSeries bars {10};
+    nlohmann::json const ohlc_json = nlohmann::json::parse(OHLC_TEXT);
+    bars.push_back(1.0850, 1.0870, 1.0840, 1.0860, 1706745600);
+    bars.push_back(1.0860, 1.0862, 1.0858, 1.0861, 1706745900);
+
+    // Stored While in Progress | The Re-Requested Bar Overwrites It & Only Later Bars are Appended
+    auto response = fxordermgmt::FXPriceBarParser::load_price_bars(ohlc_json["PriceBars"], bars, 1706745900);
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response.value().bars_revised, 1);
+    EXPECT_EQ(response.value().bars_appended, 1);
+    EXPECT_EQ(std::vector<fxordermgmt::fx_price_t>(bars.close().begin(), bars.close().end()),
+        (std::vector<fxordermgmt::fx_price_t> {1.0860, 1.0865, 1.0870}));
+    EXPECT_EQ(bars.size(), 3);
+
+    auto unchanged_response = fxordermgmt::FXPriceBarParser::load_price_bars(ohlc_json["PriceBars"], bars, 1706746200);
+    ASSERT_TRUE(unchanged_response);
+    EXPECT_EQ(unchanged_response.value().bars_revised, 0);
+    EXPECT_EQ(unchanged_response.value().bars_appended, 0);
+}
+
+TEST(FXPriceBarParserTests, Load_Price_Bars_Missing_Key)
+{
+    fxordermgmt::FXBarSeries bars {10};
+    nlohmann::json const price_bars = nlohmann::json::parse(R"([{"BarDate": "/Date(1706745600000)/", "Open": 1.0}])");
+
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::load_price_bars(price_bars, bars));
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::load_price_bars(nlohmann::json::parse(R"("123")"), bars));
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::load_price_bars(
+        nlohmann::json::parse(R"([{"BarDate": "/Date(1706745600000)/", "Open": null, "High": 1, "Low": 1, "Close": 1}])"), bars));
+
+    auto empty_response = fxordermgmt::FXPriceBarParser::load_price_bars(nlohmann::json::array(), bars);
+    ASSERT_TRUE(empty_response);
+    EXPECT_EQ(empty_response.value().bars_received, 0);
+}
+
+TEST(FXPriceBarParserTests, Bar_Closed_At_Boundary)
+{
+    nlohmann::json const price_bars = nlohmann::json::parse(OHLC_TEXT)["PriceBars"];
+
+    // Followed by a Later Bar
+    EXPECT_TRUE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706745900, 300, 1706746200));
+    // Newest Bar Closes Exactly at the End of its Interval
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706746200, 300, 1706746499));
+    EXPECT_TRUE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706746200, 300, 1706746500));
+    // A Missing Bar Falls Through to the Next One Published
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706746000, 300, 1706746300));
+    EXPECT_TRUE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706746000, 300, 1706746500));
+    // Not Yet Published
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::bar_closed(price_bars, 1706746500, 300, 1706747000));
+    EXPECT_FALSE(fxordermgmt::FXPriceBarParser::bar_closed(nlohmann::json::parse(R"([{"BarDate": "1706745600"}])"), 0, 300, 1706747000));
+}
+
+}// namespace
@@ -0,0 +1,87 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_report_worker.h"
+
+namespace
+{
+
+using fxordermgmt::FXReportSnapshot;
+using fxordermgmt::FXReportWorker;
+
+FXReportSnapshot make_snapshot(std::string const& last_updated)
+{
+    FXReportSnapshot snapshot;
+    snapshot.file_name = "FX_Management_Report_Test.json";
+    snapshot.last_updated = last_updated;
+    return snapshot;
+}
+
+TEST(FXReportWorkerTests, Stale_Snapshots_Dropped)
+{
+    std::mutex mutex;
+    std::vector<std::string> written;
+    std::promise<void> first_started, release_writer;
+    std::shared_future<void> released = release_writer.get_future().share();
+    {
+        FXReportWorker report_worker([&](FXReportSnapshot const& snapshot) {
+            if (snapshot.last_updated == "0")
+            {
+                first_started.set_value();
+                released.wait();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            written.push_back(snapshot.last_updated);
+        });
+
+        // Writer is Busy with the First Snapshot, so Only the Latest of the Rest Survives
+        report_worker.submit(make_snapshot("0"));
+        first_started.get_future().wait();
+        for (int x = 1; x <= 5; ++x) { report_worker.submit(make_snapshot(std::to_string(x))); }
+        EXPECT_EQ(report_worker.dropped_snapshots(), 4);
+        release_writer.set_value();
+    }
+    EXPECT_EQ(written, (std::vector<std::string> {"0", "5"}));
+}
+
+TEST(FXReportWorkerTests, Submit_Never_Waits_on_Writer)
+{
+    std::promise<void> release_writer;
+    std::shared_future<void> released = release_writer.get_future().share();
+    int write_count = 0;
+    {
+        FXReportWorker report_worker([&](FXReportSnapshot const&) {
+            released.wait();
+            ++write_count;
+        });
+
+        auto const start = std::chrono::steady_clock::now();
+        for (int x = 0; x < 100; ++x) { report_worker.submit(make_snapshot(std::to_string(x))); }
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+        release_writer.set_value();
+    }
+    EXPECT_GE(write_count, 1);
+    EXPECT_LE(write_count, 2);
+}
+
+TEST(FXReportWorkerTests, Destructor_Flushes_Pending_Snapshot)
+{
+    std::vector<std::string> written;
+    {
+        FXReportWorker report_worker([&](FXReportSnapshot const& snapshot) { written.push_back(snapshot.last_updated); });
+        report_worker.submit(make_snapshot("Final"));
+    }
+    ASSERT_FALSE(written.empty());
+    EXPECT_EQ(written.back(), "Final");
+    EXPECT_EQ(written.size(), 1);
+}
+
+}// namespace
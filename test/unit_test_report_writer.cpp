@@ -0,0 +1,146 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "json/json.hpp"
+
+#include "fx_report_writer.h"
+
+namespace
+{
+
+using fxordermgmt::FXPositionPerformance;
+using fxordermgmt::FXProfitReport;
+using fxordermgmt::FXReportWriter;
+
+class FXReportWriterTests : public testing::Test
+{
+  protected:
+    std::filesystem::path report_dir = std::filesystem::temp_directory_path() / "fx_report_writer_test";
+    std::string file_name = (report_dir / "FX_Management_Report_Test.json").string();
+    FXProfitReport report;
+
+    void SetUp() override
+    {
+        std::filesystem::remove_all(report_dir);
+        std::filesystem::create_directories(report_dir);
+        report.initial_funds = 45887.76;
+        report.current_funds = 45884.16;
+        report.margin_utilized = 121.73;
+        report.profit_cumulative = -3.6;
+        report.positions = {FXPositionPerformance {"USD/CAD", "buy", 1000, 1.33754, 1.337329, -0.00021, -0.02},
+            FXPositionPerformance {"EUR/USD", "sell", 2000, 1.08727, 1.08721, 0.00006, 0.01}};
+        report.last_updated = "Thu Feb  1 14:04:06 2024\n";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(report_dir); }
+
+    nlohmann::json read_report() const
+    {
+        std::ifstream in(file_name);
+        return nlohmann::json::parse(in);
+    }
+};
+
+TEST_F(FXReportWriterTests, Matches_JSON_Layout)
+{
+    FXReportWriter report_writer;
+    auto response = report_writer.write(file_name, report);
+    ASSERT_TRUE(response);
+    EXPECT_TRUE(response.value());
+
+    nlohmann::json const written = read_report();
+    nlohmann::json expected;
+    expected["Last Updated"] = report.last_updated;
+    expected["Performance Information"] = {{"Initial Funds", 45887.76}, {"Current Funds", 45884.16}, {"Margin Utilized", 121.73},
+        {"Profit Cumulative", -3.6}, {"Profit Percent Cumulative", 0.0}};
+    expected["Position Information"]["USD/CAD"] = {{"Direction", "buy"}, {"Quantity", 1000}, {"Entry Price", 1.33754},
+        {"Current Price", 1.337329}, {"Profit", -0.00021}, {"Profit Percent", -0.02}};
+    expected["Position Information"]["EUR/USD"] = {{"Direction", "sell"}, {"Quantity", 2000}, {"Entry Price", 1.08727},
+        {"Current Price", 1.08721}, {"Profit", 0.00006}, {"Profit Percent", 0.01}};
+    EXPECT_EQ(written, expected);
+    // Byte for Byte What the DOM Would Have Pretty Printed
+    EXPECT_EQ(report_writer.contents(), expected.dump(4));
+    EXPECT_FALSE(std::filesystem::exists(file_name + ".tmp"));
+}
+
+TEST_F(FXReportWriterTests, Matches_Baseline_Report_Dump)
+{
+    // Built the Way the Report Was Before the Writer: Position Fields Copied from "OpenPositions", Numbers as Floats
+    nlohmann::json const open_positions = nlohmann::json::parse(R"([
+        {"MarketName": "USD/CAD", "Direction": "buy", "Quantity": 1000, "Price": 1.33754},
+        {"MarketName": "EUR/USD", "Direction": "sell", "Quantity": 2000, "Price": 1.08727}])");
+    nlohmann::json baseline, current_positions;
+    for (FXPositionPerformance const& position : report.positions)
+    {
+        auto const& open_position = *std::find_if(open_positions.begin(), open_positions.end(),
+            [&](nlohmann::json const& entry) { return entry["MarketName"] == position.symbol; });
+        current_positions[position.symbol] = {{"Direction", open_position["Direction"]}, {"Quantity", open_position["Quantity"]},
+            {"Entry Price", open_position["Price"]}, {"Current Price", position.current_price}, {"Profit", position.profit},
+            {"Profit Percent", position.profit_percent}};
+    }
+    baseline["Performance Information"] = {{"Initial Funds", report.initial_funds}, {"Current Funds", report.current_funds},
+        {"Margin Utilized", report.margin_utilized}, {"Profit Cumulative", report.profit_cumulative},
+        {"Profit Percent Cumulative", report.profit_percent_cumulative}};
+    baseline["Position Information"] = current_positions;
+    baseline["Last Updated"] = report.last_updated;
+
+    FXReportWriter report_writer;
+    ASSERT_TRUE(report_writer.write(file_name, report));
+    EXPECT_EQ(report_writer.contents(), baseline.dump(4));
+
+    // A Fractional Quantity Stays Floating Point
+    report.positions[0].quantity = 1500.5;
+    ASSERT_TRUE(report_writer.write(file_name, report));
+    EXPECT_EQ(read_report()["Position Information"]["USD/CAD"]["Quantity"].get<double>(), 1500.5);
+}
+
+TEST_F(FXReportWriterTests, Unchanged_Content_Skips_Write)
+{
+    FXReportWriter report_writer;
+    ASSERT_TRUE(report_writer.write(file_name, report).value());
+
+    // Only the Timestamp Differs
+    report.last_updated = "Thu Feb  1 14:05:06 2024\n";
+    auto response = report_writer.write(file_name, report);
+    ASSERT_TRUE(response);
+    EXPECT_FALSE(response.value());
+    EXPECT_EQ(read_report()["Last Updated"], "Thu Feb  1 14:04:06 2024\n");
+
+    report.positions[0].current_price = 1.3374;
+    EXPECT_TRUE(report_writer.write(file_name, report).value());
+    EXPECT_EQ(read_report()["Position Information"]["USD/CAD"]["Current Price"], 1.3374);
+
+    // A Removed File or a New Day's File is Always Written
+    std::filesystem::remove(file_name);
+    EXPECT_TRUE(report_writer.write(file_name, report).value());
+    EXPECT_TRUE(report_writer.write((report_dir / "FX_Management_Report_Next.json").string(), report).value());
+}
+
+TEST_F(FXReportWriterTests, Empty_Positions_And_Escaping)
+{
+    FXReportWriter report_writer;
+    report.positions.clear();
+    report.last_updated = "\"Quoted\"\t\\";
+    ASSERT_TRUE(report_writer.write(file_name, report));
+
+    nlohmann::json const written = read_report();
+    EXPECT_EQ(written["Last Updated"], report.last_updated);
+    EXPECT_TRUE(written["Position Information"].is_object());
+    EXPECT_TRUE(written["Position Information"].empty());
+}
+
+TEST_F(FXReportWriterTests, Missing_Directory_Error)
+{
+    FXReportWriter report_writer;
+    auto response = report_writer.write((report_dir / "missing" / "report.json").string(), report);
+    EXPECT_FALSE(response);
+}
+
+}// namespace
@@ -0,0 +1,155 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_bar_series.h"
+#include "fx_indicators.h"
+#include "fx_streaming_indicators.h"
+#include "fx_trading_model_registry.h"
+
+namespace
+{
+
+using fxordermgmt::fx_price_t;
+using fxordermgmt::FXIndicators;
+
+std::vector<fx_price_t> make_prices(std::size_t size)
+{
+    std::vector<fx_price_t> prices(size);
+    for (std::size_t x = 0; x < size; ++x) { prices[x] = static_cast<fx_price_t>(1.08 + 0.002 * std::sin(0.1 * x) + 0.0001 * (x % 7)); }
+    return prices;
+}
+
+// Seed on the First Half, Stream the Rest, Compare Every Step with the Batch Result
+template <typename Streaming, typename Value>
+void expect_streaming_matches(std::vector<fx_price_t> const& batch, std::span<fx_price_t const> prices, Streaming& streaming, Value value)
+{
+    std::size_t const seed_size = prices.size() / 2;
+    streaming.seed(prices.first(seed_size));
+    EXPECT_TRUE(FXIndicators::values_match(value(streaming), batch[seed_size - 1]));
+    for (std::size_t x = seed_size; x < prices.size(); ++x)
+    {
+        streaming.update(prices[x]);
+        EXPECT_TRUE(FXIndicators::values_match(value(streaming), batch[x])) << "Index " << x;
+    }
+}
+
+TEST(FXStreamingIndicatorsTests, SMA_EMA_Match_Batch)
+{
+    std::vector<fx_price_t> const prices = make_prices(1'001);
+    std::vector<fx_price_t> batch(prices.size());
+
+    ASSERT_TRUE(FXIndicators::sma(prices, 20, batch));
+    fxordermgmt::FXStreamingSMA sma {20};
+    expect_streaming_matches(batch, prices, sma, [](auto const& indicator) { return indicator.value(); });
+
+    ASSERT_TRUE(FXIndicators::ema(prices, 20, batch));
+    fxordermgmt::FXStreamingEMA ema {20};
+    expect_streaming_matches(batch, prices, ema, [](auto const& indicator) { return indicator.value(); });
+}
+
+TEST(FXStreamingIndicatorsTests, Stats_Match_Batch)
+{
+    std::vector<fx_price_t> const prices = make_prices(601);
+    std::vector<fx_price_t> stdev(prices.size()), upper(prices.size()), middle(prices.size()), lower(prices.size());
+
+    ASSERT_TRUE(FXIndicators::rolling_stdev(prices, 20, stdev));
+    ASSERT_TRUE(FXIndicators::bollinger(prices, 20, 2, upper, middle, lower));
+
+    fxordermgmt::FXStreamingStats stats {20};
+    expect_streaming_matches(stdev, prices, stats, [](auto const& indicator) { return indicator.stdev(); });
+    expect_streaming_matches(middle, prices, stats, [](auto const& indicator) { return indicator.mean(); });
+    expect_streaming_matches(upper, prices, stats, [](auto const& indicator) { return indicator.upper_band(2); });
+    expect_streaming_matches(lower, prices, stats, [](auto const& indicator) { return indicator.lower_band(2); });
+}
+
+TEST(FXStreamingIndicatorsTests, ZScore_Matches_Batch)
+{
+    std::vector<fx_price_t> const prices = make_prices(301);
+    std::vector<fx_price_t> batch(prices.size());
+    ASSERT_TRUE(FXIndicators::zscore(prices, 20, batch));
+
+    fxordermgmt::FXStreamingStats stats {20};
+    stats.seed(std::span<fx_price_t const> {prices}.first(100));
+    for (std::size_t x = 100; x < prices.size(); ++x)
+    {
+        stats.update(prices[x]);
+        EXPECT_NEAR(stats.zscore(), batch[x], 1e-2);
+    }
+}
+
+TEST(FXStreamingIndicatorsTests, RSI_MACD_Match_Batch)
+{
+    std::vector<fx_price_t> const prices = make_prices(801);
+    std::vector<fx_price_t> batch(prices.size()), signal_line(prices.size()), histogram(prices.size());
+
+    ASSERT_TRUE(FXIndicators::rsi(prices, 14, batch));
+    fxordermgmt::FXStreamingRSI rsi {14};
+    expect_streaming_matches(batch, prices, rsi, [](auto const& indicator) { return indicator.value(); });
+
+    ASSERT_TRUE(FXIndicators::macd(prices, 12, 26, 9, batch, signal_line, histogram));
+    fxordermgmt::FXStreamingMACD macd {12, 26, 9};
+    expect_streaming_matches(signal_line, prices, macd, [](auto const& indicator) { return indicator.signal_line(); });
+}
+
+TEST(FXStreamingIndicatorsTests, ATR_Matches_Batch)
+{
+    std::vector<fx_price_t> const close = make_prices(403);
+    std::vector<fx_price_t> high(close.size()), low(close.size()), batch(close.size());
+    for (std::size_t x = 0; x < close.size(); ++x)
+    {
+        high[x] = close[x] + 0.0005F;
+        low[x] = close[x] - 0.0003F;
+    }
+    ASSERT_TRUE(FXIndicators::atr(high, low, close, 14, batch));
+
+    fxordermgmt::FXStreamingATR atr {14};
+    atr.seed(std::span<fx_price_t const> {high}.first(200), std::span<fx_price_t const> {low}.first(200),
+        std::span<fx_price_t const> {close}.first(200));
+    EXPECT_TRUE(FXIndicators::values_match(atr.value(), batch[199]));
+    for (std::size_t x = 200; x < close.size(); ++x) { EXPECT_TRUE(FXIndicators::values_match(atr.update(high[x], low[x], close[x]), batch[x])); }
+}
+
+TEST(FXStreamingIndicatorsTests, Not_Ready_Until_Full_Window)
+{
+    fxordermgmt::FXStreamingSMA sma {3};
+    EXPECT_TRUE(std::isnan(sma.update(1)));
+    EXPECT_TRUE(std::isnan(sma.update(2)));
+    EXPECT_FALSE(sma.ready());
+    EXPECT_FLOAT_EQ(sma.update(3), 2);
+    EXPECT_TRUE(sma.ready());
+}
+
+TEST(FXStreamingIndicatorsTests, Model_Hooks_And_Verification)
+{
+    auto response = fxordermgmt::FXTradingModelRegistry::instance().create("SMA_Crossover", {{"Fast_Period", 3}, {"Slow_Period", 8}});
+    ASSERT_TRUE(response);
+    fxordermgmt::ITradingModel& model = *response.value();
+
+    std::vector<fx_price_t> const prices = make_prices(60);
+    fxordermgmt::FXBarSeries bars {40};
+    for (std::size_t x = 0; x < 40; ++x) { bars.push_back(1, 1, 1, prices[x], static_cast<std::int64_t>(x)); }
+
+    model.on_history_loaded(bars);
+    EXPECT_TRUE(model.verify_streaming_state(bars));
+
+    for (std::size_t x = 40; x < 60; x += 2)
+    {
+        bars.push_back(1, 1, 1, prices[x], static_cast<std::int64_t>(x));
+        bars.push_back(1, 1, 1, prices[x + 1], static_cast<std::int64_t>(x + 1));
+        model.on_new_bars(bars, 2);
+        EXPECT_TRUE(model.verify_streaming_state(bars));
+    }
+
+    // Bars Appended Without the Hook are Detected
+    bars.push_back(1, 1, 1, 2.0F, 60);
+    EXPECT_FALSE(model.verify_streaming_state(bars));
+}
+
+}// namespace
@@ -0,0 +1,97 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "fx_task_pool.h"
+
+namespace
+{
+
+TEST(FXTaskPoolTests, Parallel_For_Runs_Every_Task)
+{
+    std::vector<int> results(100, 0);
+
+    fxordermgmt::FXTaskPool::parallel_for(results.size(), 4, [&](std::size_t x) { results[x] = static_cast<int>(x) * 2; });
+
+    for (std::size_t x = 0; x < results.size(); ++x) { EXPECT_EQ(results[x], x * 2); }
+}
+
+TEST(FXTaskPoolTests, Parallel_For_Respects_Concurrency_Cap)
+{
+    std::atomic<int> active {0}, max_active {0};
+
+    fxordermgmt::FXTaskPool::parallel_for(50, 3, [&](std::size_t) {
+        int const now_active = ++active;
+        int observed = max_active.load();
+        while (now_active > observed && ! max_active.compare_exchange_weak(observed, now_active)) {}
+        --active;
+    });
+
+    EXPECT_LE(max_active.load(), 3);
+}
+
+TEST(FXTaskPoolTests, Parallel_For_Zero_Tasks)
+{
+    int calls = 0;
+    fxordermgmt::FXTaskPool::parallel_for(0, 4, [&](std::size_t) { ++calls; });
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(FXTaskPoolTests, Parallel_For_Rethrows_Task_Error)
+{
+    EXPECT_THROW(fxordermgmt::FXTaskPool::parallel_for(
+                     10, 4,
+                     [](std::size_t x) {
+                         if (x == 5)
+                         {
+                             throw std::runtime_error {"Task Failed"};
+                         }
+                     }),
+        std::runtime_error);
+}
+
+TEST(FXTaskPoolTests, Work_Stealing_Runs_Every_Task_Once)
+{
+    std::vector<std::atomic<int>> calls(1'000);
+
+    // Front Loaded Work so Idle Workers Must Steal
+    fxordermgmt::FXTaskPool::work_stealing_for(calls.size(), 4, [&](std::size_t x) {
+        if (x < 50)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        ++calls[x];
+    });
+
+    for (auto const& count : calls) { EXPECT_EQ(count.load(), 1); }
+}
+
+TEST(FXTaskPoolTests, Work_Stealing_Single_Thread_In_Order)
+{
+    std::vector<std::size_t> order;
+    fxordermgmt::FXTaskPool::work_stealing_for(5, 1, [&](std::size_t x) { order.push_back(x); });
+    EXPECT_EQ(order, (std::vector<std::size_t> {0, 1, 2, 3, 4}));
+}
+
+TEST(FXTaskPoolTests, Work_Stealing_Rethrows_Task_Error)
+{
+    EXPECT_THROW(fxordermgmt::FXTaskPool::work_stealing_for(
+                     20, 4,
+                     [](std::size_t x) {
+                         if (x == 17)
+                         {
+                             throw std::runtime_error {"Task Failed"};
+                         }
+                     }),
+        std::runtime_error);
+}
+
+}// namespace
@@ -0,0 +1,79 @@
+// Copyright 2024, Andrew Drogalis
+// GNU License
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "fx_bar_series.h"
+#include "fx_trading_model.h"
+#include "fx_trading_model_interface.h"
+#include "fx_trading_model_registry.h"
+
+namespace
+{
+
+class ThresholdModel : public fxordermgmt::ITradingModel
+{
+  public:
+    explicit ThresholdModel(fxordermgmt::FXModelParameters const& parameters)
+        : threshold(parameters.contains("Threshold") ? parameters.at("Threshold") : 0.0)
+    {
+    }
+
+    int send_trading_signal(fxordermgmt::FXBarSeries const& price_bars) override
+    {
+        if (price_bars.close().empty())
+        {
+            return 0;
+        }
+        return (price_bars.close().back() > threshold) ? 1 : -1;
+    }
+
+  private:
+    double threshold;
+};
+
+fxordermgmt::FXRegisterTradingModel<ThresholdModel> const threshold_registration {"Unit_Test_Threshold"};
+
+TEST(FXTradingModelTests, Placeholder_Registered)
+{
+    auto& registry = fxordermgmt::FXTradingModelRegistry::instance();
+
+    EXPECT_TRUE(registry.contains("Placeholder"));
+
+    auto response = registry.create("Placeholder");
+    ASSERT_TRUE(response);
+
+    fxordermgmt::FXBarSeries bars {1};
+    int const signal = response.value()->send_trading_signal(bars);
+    EXPECT_TRUE(signal == 1 || signal == -1);
+}
+
+TEST(FXTradingModelTests, Create_With_Parameters)
+{
+    fxordermgmt::FXBarSeries bars {2};
+    bars.push_back(1.0, 1.0, 1.0, 1.5, 100);
+
+    auto response = fxordermgmt::FXTradingModelRegistry::instance().create("Unit_Test_Threshold", {{"Threshold", 1.0}});
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response.value()->send_trading_signal(bars), 1);
+
+    auto high_threshold = fxordermgmt::FXTradingModelRegistry::instance().create("Unit_Test_Threshold", {{"Threshold", 2.0}});
+    ASSERT_TRUE(high_threshold);
+    EXPECT_EQ(high_threshold.value()->send_trading_signal(bars), -1);
+}
+
+TEST(FXTradingModelTests, Duplicate_And_Unknown_Names)
+{
+    auto& registry = fxordermgmt::FXTradingModelRegistry::instance();
+
+    EXPECT_FALSE(registry.register_model("Placeholder", [](fxordermgmt::FXModelParameters const&) { return nullptr; }));
+
+    auto response = registry.create("Does_Not_Exist");
+    ASSERT_FALSE(response);
+    EXPECT_NE(std::string(response.error().what()).find("Placeholder"), std::string::npos);
+}
+
+}// namespace